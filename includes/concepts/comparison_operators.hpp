@@ -9,34 +9,42 @@
 // https://en.cppreference.com/w/cpp/language/operator_comparison.html
 namespace stronger::concepts
 {
+
+/// Comparisons result in a bool, or in a mask of bools for data-parallel types such as std::experimental::simd.
+/// Masks are recognized by the all_of function, found by argument-dependent lookup.
+template <typename Result>
+concept comparison_result = std::same_as<Result, bool> || requires(const Result& mask) {
+    { all_of(mask) } -> std::same_as<bool>;
+};
+
 template <typename T>
 concept supports_equal_to = requires(T a, T b) {
-    { a == b } -> std::same_as<bool>;
+    { a == b } -> comparison_result;
 };
 
 template <typename T>
 concept supports_not_equal_to = requires(T a, T b) {
-    { a != b } -> std::same_as<bool>;
+    { a != b } -> comparison_result;
 };
 
 template <typename T>
 concept supports_less_than = requires(T a, T b) {
-    { a < b } -> std::same_as<bool>;
+    { a < b } -> comparison_result;
 };
 
 template <typename T>
 concept supports_greater_than = requires(T a, T b) {
-    { a > b } -> std::same_as<bool>;
+    { a > b } -> comparison_result;
 };
 
 template <typename T>
 concept supports_less_than_or_equal_to = requires(T a, T b) {
-    { a <= b } -> std::same_as<bool>;
+    { a <= b } -> comparison_result;
 };
 
 template <typename T>
 concept supports_greater_than_or_equal_to = requires(T a, T b) {
-    { a >= b } -> std::same_as<bool>;
+    { a >= b } -> comparison_result;
 };
 
 template <typename T>
@@ -2,7 +2,7 @@
 // Licensed under the MIT License. See LICENSE file for details.
 
 #pragma once
-#include <concepts>
+#include "concepts/comparison_operators.hpp"
 
 // Support operators defined here:
 // https://en.cppreference.com/w/cpp/language/operator_logical.html
@@ -12,7 +12,7 @@ namespace stronger::concepts
 
 template <typename T>
 concept supports_negation = requires(T a) {
-    { !a } -> std::same_as<bool>;
+    { !a } -> comparison_result;
 };
 
 }  // namespace strongercpp::concepts
\ No newline at end of file
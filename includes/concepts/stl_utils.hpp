@@ -3,29 +3,18 @@
 
 #pragma once
 #include <concepts>
-#include <format>
-#include <iosfwd>
+#include <type_traits>
+#include <utility>
 
 namespace stronger::concepts
 {
 
 template <typename T>
-concept supports_ostream_insertion = requires(std::ostream& os, T a) {
-    { os << a } -> std::same_as<std::ostream&>;
-};
-
-template <typename T>
-concept supports_std_hash = requires(const T& value) {
-    { std::hash<T>{}(value) };
-};
+concept supports_default_construction = std::is_default_constructible_v<T>;
 
-template <typename T>
-concept supports_std_format = requires(const T& value) {
-    { std::format("{}", value) };
+template <typename T, typename U>
+concept supports_brace_construction_from = requires(U&& value) {
+    { T{ std::forward<U>(value) } };
 };
 
-
-template <typename T>
-concept supports_default_construction = std::is_default_constructible_v<T>;
-
 }  // namespace stronger::concepts
\ No newline at end of file
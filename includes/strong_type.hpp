@@ -10,9 +10,28 @@
 #include "concepts/logical_operators.hpp"
 #include "concepts/other_operators.hpp"
 #include "concepts/stl_utils.hpp"
+#include "traits/binding.hpp"
 #include "traits/traits.hpp"
+#include <concepts>
+#include <type_traits>
 #include <utility>
 
+// Strong types are trivially relocatable when their underlying type is: Clang drops trivial_abi from the instantiations
+// whose underlying type is not trivial for the purpose of calls, and the C++26 keyword has the same eligibility rules
+#if defined(__clang__) && defined(__has_cpp_attribute)
+#if __has_cpp_attribute(clang::trivial_abi)
+#define STRONGER_CPP_TRIVIAL_ABI [[clang::trivial_abi]]
+#endif
+#endif
+#ifndef STRONGER_CPP_TRIVIAL_ABI
+#define STRONGER_CPP_TRIVIAL_ABI
+#endif
+#ifdef __cpp_trivial_relocatability
+#define STRONGER_CPP_TRIVIALLY_RELOCATABLE_IF_ELIGIBLE trivially_relocatable_if_eligible
+#else
+#define STRONGER_CPP_TRIVIALLY_RELOCATABLE_IF_ELIGIBLE
+#endif
+
 namespace stronger
 {
 
@@ -21,8 +40,67 @@ enum class options
     allow_implicit_construction,
     allow_implicit_conversion_to_underlying_type,
     drill_down,
+    bounds_checked,  // Strong containers only: subscripting throws std::out_of_range on invalid indices
+    elementwise,     // Ranges of arithmetic types only: arithmetic operators build lazy elementwise expressions
+    modular,         // Point types of unsigned integers only: comparisons follow wrap-around (serial number) order
+    checked_arithmetic,     // Integers only: arithmetic and shifts throw std::overflow_error instead of overflowing
+    saturating_arithmetic,  // Integers only: arithmetic and shifts clamp to the range of the type on overflow
+};
+
+template <typename T, size_t Tag, options... Options>
+class strong_type;
+
+namespace internal::overflow
+{
+
+enum class mode
+{
+    checked,     // std::overflow_error, or std::domain_error on division by zero
+    saturating,  // Closest value of T. Division by zero is still undefined behavior
+};
+
+template <typename T>
+concept supported = std::integral<T> && !std::same_as<std::remove_cv_t<T>, bool>;
+
+/// Operators of strong integers with options::checked_arithmetic or options::saturating_arithmetic, defined by
+/// stronger/overflow.hpp, so that strong types that don't use them don't depend on <stdexcept>
+template <mode Mode, typename T>
+struct arithmetic
+{
+    static_assert(!std::is_same_v<T, T>,
+                  "stronger: include stronger/overflow.hpp to use checked or saturating arithmetic");
+};
+
+}  // namespace internal::overflow
+
+template <size_t Tag, typename Operation, typename... Operands>
+class elementwise_expression;
+
+namespace traits
+{
+
+/// Gives access to the template arguments of a strong_type
+template <typename T>
+struct strong_type_info
+{
+    static constexpr bool is_strong_type = false;
+};
+
+template <typename T, size_t Tag, options... Options>
+struct strong_type_info<strong_type<T, Tag, Options...>>
+{
+    static constexpr bool is_strong_type = true;
+    using underlying_type = T;
+    static constexpr size_t tag = Tag;
+    template <options Option>
+    static constexpr bool has_option = ((Option == Options) || ...);
 };
 
+template <typename T>
+constexpr bool is_strong_type = strong_type_info<std::remove_cvref_t<T>>::is_strong_type;
+
+}  // namespace traits
+
 /**
  *
  * @tparam T Underlying type you want to make strong
@@ -31,7 +109,7 @@ enum class options
  * @tparam Options options to enable
  */
 template <typename T, size_t Tag, options... Options>
-class strong_type
+class STRONGER_CPP_TRIVIAL_ABI strong_type STRONGER_CPP_TRIVIALLY_RELOCATABLE_IF_ELIGIBLE
 {
     using const_reference_like = std::conditional_t<traits::should_pass_by_value<T>, strong_type, const strong_type&>;
     using reference = strong_type&;
@@ -39,51 +117,112 @@ class strong_type
     constexpr static bool option_enabled = ((Option == Options) || ...);
     template <options Option>
     constexpr static bool option_disabled = !option_enabled<Option>;
+
+    // Selects the binary operator overloads that move a temporary operand through to the underlying operator, so that
+    // the underlying type can reuse its storage (e.g. `std::string&& + const std::string&`).
+    // Types passed by value are excluded: moving them is a copy anyway.
+    template <typename Operand>
+    constexpr static bool is_movable_operand = std::same_as<std::remove_cvref_t<Operand>, strong_type> &&
+                                               !std::is_lvalue_reference_v<Operand> &&
+                                               !std::is_const_v<std::remove_reference_t<Operand>>;
+    template <typename Lhs, typename Rhs>
+    constexpr static bool forwards_rvalue_operands = !traits::should_pass_by_value<T> &&
+                                                     std::same_as<std::remove_cvref_t<Lhs>, strong_type> &&
+                                                     std::same_as<std::remove_cvref_t<Rhs>, strong_type> &&
+                                                     (is_movable_operand<Lhs> || is_movable_operand<Rhs>);
+    // Operators between two operands of this strong type give way to the binding declared for them, if any
+    template <typename Operation>
+    constexpr static bool is_rebound = traits::is_bound<Operation, strong_type, strong_type>;
     using enum options;
+    // Integers with checked or saturating arithmetic use the overflow-aware operators instead of the inherited ones
+    constexpr static bool is_overflow_aware =
+        option_enabled<checked_arithmetic> || option_enabled<saturating_arithmetic>;
+    constexpr static internal::overflow::mode overflow_mode =
+        option_enabled<checked_arithmetic> ? internal::overflow::mode::checked : internal::overflow::mode::saturating;
+    constexpr static bool is_nothrow_overflow_aware = overflow_mode == internal::overflow::mode::saturating;
+    using overflow_arithmetic = internal::overflow::arithmetic<overflow_mode, T>;
+    // Both operands are this strong type, or one of them converts implicitly to it
+    template <typename Lhs, typename Rhs>
+    constexpr static bool is_overflow_aware_operation =
+        is_overflow_aware && std::convertible_to<const Lhs&, strong_type> &&
+        std::convertible_to<const Rhs&, strong_type> &&
+        (std::same_as<Lhs, strong_type> || std::same_as<Rhs, strong_type>);
+
+    [[nodiscard]] static constexpr T value_of(const strong_type operand) noexcept { return operand.m_value; }
 
 public:
 
     using underlying_type = T;
 
+    static_assert(!is_overflow_aware || internal::overflow::supported<T>,
+                  "stronger: checked and saturating arithmetic require an integral underlying type");
+    static_assert(!(option_enabled<checked_arithmetic> && option_enabled<saturating_arithmetic>),
+                  "stronger: checked and saturating arithmetic can't be enabled together");
+
     strong_type()
         requires concepts::supports_default_construction<T>
     = default;
 
-    constexpr explicit(option_disabled<allow_implicit_construction>) strong_type(T&& value) :
+    constexpr explicit(option_disabled<allow_implicit_construction>) strong_type(T&& value)
+        noexcept(traits::is_nothrow_brace_constructible<T, T&&>) :
             m_value{ std::forward<T>(value) }
     {
     }
 
+    constexpr explicit(option_disabled<allow_implicit_construction>) strong_type(const T& value)
+        noexcept(traits::is_nothrow_brace_constructible<T, const T&>)
+        requires std::is_copy_constructible_v<T> && (!std::is_reference_v<T>)
+            : m_value{ value }
+    {
+    }
+
+    /// Constructs the underlying value directly from `value`, without any intermediate copy or move of T.
+    /// Strong types are never accepted here, to keep different strong types apart.
+    template <typename U>
+        requires(!traits::is_strong_type<U>) && (!std::same_as<std::remove_cvref_t<U>, T>) &&
+                (!std::same_as<std::remove_cvref_t<U>, std::in_place_t>) &&
+                concepts::supports_brace_construction_from<T, U>
+    constexpr explicit(option_disabled<allow_implicit_construction> || !std::is_convertible_v<U, T>)
+        strong_type(U&& value) noexcept(traits::is_nothrow_brace_constructible<T, U&&>) :
+            m_value{ std::forward<U>(value) }
+    {
+    }
+
     template <typename... Args>
-    constexpr explicit strong_type(std::in_place_t, Args&&... args) : m_value{ std::forward<Args>(args)... }
+    constexpr explicit strong_type(std::in_place_t, Args&&... args)
+        noexcept(traits::is_nothrow_brace_constructible<T, Args&&...>) :
+            m_value{ std::forward<Args>(args)... }
     {
     }
 
-    constexpr decltype(auto) operator*(this auto&& self) { return std::forward_like<decltype(self)>(self.m_value); }
+    constexpr decltype(auto) operator*(this auto&& self) noexcept
+    {
+        return std::forward_like<decltype(self)>(self.m_value);
+    }
 
-    constexpr decltype(auto) operator->(this auto&& self)
+    constexpr decltype(auto) operator->(this auto&& self) noexcept
     {
         if constexpr(std::is_pointer_v<underlying_type> || option_enabled<drill_down>)
             return std::forward_like<decltype(self)>(self.m_value);
         else
-            return std::addressof(self.m_value);
+            return __builtin_addressof(self.m_value);  // std::addressof, without including <memory>
     }
 
     // Implicit conversions ............................................................................................
 
-    [[nodiscard]] explicit(false) constexpr operator const underlying_type&() const&
+    [[nodiscard]] explicit(false) constexpr operator const underlying_type&() const& noexcept
         requires option_enabled<allow_implicit_conversion_to_underlying_type>
     {
         return m_value;
     }
 
-    [[nodiscard]] explicit(false) constexpr operator underlying_type&() &
+    [[nodiscard]] explicit(false) constexpr operator underlying_type&() & noexcept
         requires option_enabled<allow_implicit_conversion_to_underlying_type>
     {
         return m_value;
     }
 
-    [[nodiscard]] explicit(false) constexpr operator underlying_type&&() &&
+    [[nodiscard]] explicit(false) constexpr operator underlying_type&&() && noexcept
         requires option_enabled<allow_implicit_conversion_to_underlying_type>
     {
         return std::move(m_value);
@@ -92,121 +231,236 @@ public:
     // Arithmetic operators ............................................................................................
 
     [[nodiscard]] constexpr friend strong_type operator+(const_reference_like rhs)
+        noexcept(noexcept(strong_type{ +rhs.m_value }))
         requires concepts::supports_unary_plus<T>
     {
         return strong_type{ +rhs.m_value };
     }
 
     [[nodiscard]] constexpr friend strong_type operator-(const_reference_like rhs)
-        requires concepts::supports_unary_minus<T>
+        noexcept(noexcept(strong_type{ -rhs.m_value }))
+        requires concepts::supports_unary_minus<T> && (!is_overflow_aware)
     {
         return strong_type{ -rhs.m_value };
     }
 
     [[nodiscard]] constexpr friend strong_type operator+(const_reference_like lhs, const_reference_like rhs)
-        requires concepts::supports_addition<T>
+        noexcept(noexcept(strong_type{ lhs.m_value + rhs.m_value }))
+        requires concepts::supports_addition<T> && (!is_rebound<operations::addition>) && (!is_overflow_aware)
     {
         return strong_type{ lhs.m_value + rhs.m_value };
     }
 
+    template <typename Lhs, typename Rhs>
+    [[nodiscard]] constexpr friend strong_type operator+(Lhs&& lhs, Rhs&& rhs)
+        noexcept(noexcept(strong_type{ std::forward<Lhs>(lhs).m_value + std::forward<Rhs>(rhs).m_value }))
+        requires concepts::supports_addition<T> && (!is_rebound<operations::addition>) &&
+                 forwards_rvalue_operands<Lhs, Rhs>
+    {
+        return strong_type{ std::forward<Lhs>(lhs).m_value + std::forward<Rhs>(rhs).m_value };
+    }
+
     [[nodiscard]] constexpr friend strong_type operator-(const_reference_like lhs, const_reference_like rhs)
-        requires concepts::supports_subtraction<T>
+        noexcept(noexcept(strong_type{ lhs.m_value - rhs.m_value }))
+        requires concepts::supports_subtraction<T> && (!is_rebound<operations::subtraction>) && (!is_overflow_aware)
     {
         return strong_type{ lhs.m_value - rhs.m_value };
     }
 
+    template <typename Lhs, typename Rhs>
+    [[nodiscard]] constexpr friend strong_type operator-(Lhs&& lhs, Rhs&& rhs)
+        noexcept(noexcept(strong_type{ std::forward<Lhs>(lhs).m_value - std::forward<Rhs>(rhs).m_value }))
+        requires concepts::supports_subtraction<T> && (!is_rebound<operations::subtraction>) &&
+                 forwards_rvalue_operands<Lhs, Rhs>
+    {
+        return strong_type{ std::forward<Lhs>(lhs).m_value - std::forward<Rhs>(rhs).m_value };
+    }
+
     [[nodiscard]] constexpr friend strong_type operator*(const_reference_like lhs, const_reference_like rhs)
-        requires concepts::supports_multiplication<T>
+        noexcept(noexcept(strong_type{ lhs.m_value * rhs.m_value }))
+        requires concepts::supports_multiplication<T> && (!is_rebound<operations::multiplication>) &&
+                 (!is_overflow_aware)
     {
         return strong_type{ lhs.m_value * rhs.m_value };
     }
 
+    template <typename Lhs, typename Rhs>
+    [[nodiscard]] constexpr friend strong_type operator*(Lhs&& lhs, Rhs&& rhs)
+        noexcept(noexcept(strong_type{ std::forward<Lhs>(lhs).m_value * std::forward<Rhs>(rhs).m_value }))
+        requires concepts::supports_multiplication<T> && (!is_rebound<operations::multiplication>) &&
+                 forwards_rvalue_operands<Lhs, Rhs>
+    {
+        return strong_type{ std::forward<Lhs>(lhs).m_value * std::forward<Rhs>(rhs).m_value };
+    }
+
     [[nodiscard]] constexpr friend strong_type operator/(const_reference_like lhs, const_reference_like rhs)
-        requires concepts::supports_division<T>
+        noexcept(noexcept(strong_type{ lhs.m_value / rhs.m_value }))
+        requires concepts::supports_division<T> && (!is_rebound<operations::division>) && (!is_overflow_aware)
     {
         return strong_type{ lhs.m_value / rhs.m_value };
     }
 
+    template <typename Lhs, typename Rhs>
+    [[nodiscard]] constexpr friend strong_type operator/(Lhs&& lhs, Rhs&& rhs)
+        noexcept(noexcept(strong_type{ std::forward<Lhs>(lhs).m_value / std::forward<Rhs>(rhs).m_value }))
+        requires concepts::supports_division<T> && (!is_rebound<operations::division>) &&
+                 forwards_rvalue_operands<Lhs, Rhs>
+    {
+        return strong_type{ std::forward<Lhs>(lhs).m_value / std::forward<Rhs>(rhs).m_value };
+    }
+
     [[nodiscard]] constexpr friend strong_type operator%(const_reference_like lhs, const_reference_like rhs)
-        requires concepts::supports_remainder<T>
+        noexcept(noexcept(strong_type{ lhs.m_value % rhs.m_value }))
+        requires concepts::supports_remainder<T> && (!is_rebound<operations::remainder>) && (!is_overflow_aware)
     {
         return strong_type{ lhs.m_value % rhs.m_value };
     }
 
+    template <typename Lhs, typename Rhs>
+    [[nodiscard]] constexpr friend strong_type operator%(Lhs&& lhs, Rhs&& rhs)
+        noexcept(noexcept(strong_type{ std::forward<Lhs>(lhs).m_value % std::forward<Rhs>(rhs).m_value }))
+        requires concepts::supports_remainder<T> && (!is_rebound<operations::remainder>) &&
+                 forwards_rvalue_operands<Lhs, Rhs>
+    {
+        return strong_type{ std::forward<Lhs>(lhs).m_value % std::forward<Rhs>(rhs).m_value };
+    }
+
     [[nodiscard]] constexpr friend strong_type operator~(const_reference_like rhs)
+        noexcept(noexcept(strong_type{ ~rhs.m_value }))
         requires concepts::supports_bitwise_not<T>
     {
         return strong_type{ ~rhs.m_value };
     }
 
     [[nodiscard]] constexpr friend strong_type operator&(const_reference_like lhs, const_reference_like rhs)
+        noexcept(noexcept(strong_type{ lhs.m_value & rhs.m_value }))
         requires concepts::supports_bitwise_and<T>
     {
         return strong_type{ lhs.m_value & rhs.m_value };
     }
 
+    template <typename Lhs, typename Rhs>
+    [[nodiscard]] constexpr friend strong_type operator&(Lhs&& lhs, Rhs&& rhs)
+        noexcept(noexcept(strong_type{ std::forward<Lhs>(lhs).m_value & std::forward<Rhs>(rhs).m_value }))
+        requires concepts::supports_bitwise_and<T> && forwards_rvalue_operands<Lhs, Rhs>
+    {
+        return strong_type{ std::forward<Lhs>(lhs).m_value & std::forward<Rhs>(rhs).m_value };
+    }
+
     [[nodiscard]] constexpr friend strong_type operator|(const_reference_like lhs, const_reference_like rhs)
+        noexcept(noexcept(strong_type{ lhs.m_value | rhs.m_value }))
         requires concepts::supports_bitwise_or<T>
     {
         return strong_type{ lhs.m_value | rhs.m_value };
     }
 
+    template <typename Lhs, typename Rhs>
+    [[nodiscard]] constexpr friend strong_type operator|(Lhs&& lhs, Rhs&& rhs)
+        noexcept(noexcept(strong_type{ std::forward<Lhs>(lhs).m_value | std::forward<Rhs>(rhs).m_value }))
+        requires concepts::supports_bitwise_or<T> && forwards_rvalue_operands<Lhs, Rhs>
+    {
+        return strong_type{ std::forward<Lhs>(lhs).m_value | std::forward<Rhs>(rhs).m_value };
+    }
+
     [[nodiscard]] constexpr friend strong_type operator^(const_reference_like lhs, const_reference_like rhs)
+        noexcept(noexcept(strong_type{ lhs.m_value ^ rhs.m_value }))
         requires concepts::supports_bitwise_xor<T>
     {
         return strong_type{ lhs.m_value ^ rhs.m_value };
     }
 
+    template <typename Lhs, typename Rhs>
+    [[nodiscard]] constexpr friend strong_type operator^(Lhs&& lhs, Rhs&& rhs)
+        noexcept(noexcept(strong_type{ std::forward<Lhs>(lhs).m_value ^ std::forward<Rhs>(rhs).m_value }))
+        requires concepts::supports_bitwise_xor<T> && forwards_rvalue_operands<Lhs, Rhs>
+    {
+        return strong_type{ std::forward<Lhs>(lhs).m_value ^ std::forward<Rhs>(rhs).m_value };
+    }
+
     [[nodiscard]] constexpr friend strong_type operator<<(const_reference_like lhs, const_reference_like rhs)
-        requires concepts::supports_bitwise_left_shift<T>
+        noexcept(noexcept(strong_type{ lhs.m_value << rhs.m_value }))
+        requires concepts::supports_bitwise_left_shift<T> && (!is_overflow_aware)
     {
         return strong_type{ lhs.m_value << rhs.m_value };
     }
 
+    template <typename Lhs, typename Rhs>
+    [[nodiscard]] constexpr friend strong_type operator<<(Lhs&& lhs, Rhs&& rhs)
+        noexcept(noexcept(strong_type{ std::forward<Lhs>(lhs).m_value << std::forward<Rhs>(rhs).m_value }))
+        requires concepts::supports_bitwise_left_shift<T> && forwards_rvalue_operands<Lhs, Rhs>
+    {
+        return strong_type{ std::forward<Lhs>(lhs).m_value << std::forward<Rhs>(rhs).m_value };
+    }
+
     [[nodiscard]] constexpr friend strong_type operator>>(const_reference_like lhs, const_reference_like rhs)
-        requires concepts::supports_bitwise_right_shift<T>
+        noexcept(noexcept(strong_type{ lhs.m_value >> rhs.m_value }))
+        requires concepts::supports_bitwise_right_shift<T> && (!is_overflow_aware)
     {
         return strong_type{ lhs.m_value >> rhs.m_value };
     }
 
+    template <typename Lhs, typename Rhs>
+    [[nodiscard]] constexpr friend strong_type operator>>(Lhs&& lhs, Rhs&& rhs)
+        noexcept(noexcept(strong_type{ std::forward<Lhs>(lhs).m_value >> std::forward<Rhs>(rhs).m_value }))
+        requires concepts::supports_bitwise_right_shift<T> && forwards_rvalue_operands<Lhs, Rhs>
+    {
+        return strong_type{ std::forward<Lhs>(lhs).m_value >> std::forward<Rhs>(rhs).m_value };
+    }
+
     // Assignment operators ............................................................................................
 
+    /// Evaluates an elementwise expression with the same tag in a single loop, reusing the current storage.
+    /// See stronger/elementwise.hpp.
+    template <typename Operation, typename... Operands>
+    constexpr reference operator=(const elementwise_expression<Tag, Operation, Operands...>& expression)
+        requires option_enabled<elementwise>
+    {
+        expression.evaluate_into(*this);
+        return *this;
+    }
+
     constexpr friend reference operator+=(reference lhs, const_reference_like rhs)
-        requires concepts::supports_addition_assignment<T>
+        noexcept(noexcept(lhs.m_value += rhs.m_value))
+        requires concepts::supports_addition_assignment<T> && (!is_overflow_aware)
     {
         lhs.m_value += rhs.m_value;
         return lhs;
     }
 
     constexpr friend reference operator-=(reference lhs, const_reference_like rhs)
-        requires concepts::supports_subtraction_assignment<T>
+        noexcept(noexcept(lhs.m_value -= rhs.m_value))
+        requires concepts::supports_subtraction_assignment<T> && (!is_overflow_aware)
     {
         lhs.m_value -= rhs.m_value;
         return lhs;
     }
 
     constexpr friend reference operator*=(reference lhs, const_reference_like rhs)
-        requires concepts::supports_multiplication_assignment<T>
+        noexcept(noexcept(lhs.m_value *= rhs.m_value))
+        requires concepts::supports_multiplication_assignment<T> && (!is_overflow_aware)
     {
         lhs.m_value *= rhs.m_value;
         return lhs;
     }
 
     constexpr friend reference operator/=(reference lhs, const_reference_like rhs)
-        requires concepts::supports_division_assignment<T>
+        noexcept(noexcept(lhs.m_value /= rhs.m_value))
+        requires concepts::supports_division_assignment<T> && (!is_overflow_aware)
     {
         lhs.m_value /= rhs.m_value;
         return lhs;
     }
 
     constexpr friend reference operator%=(reference lhs, const_reference_like rhs)
-        requires concepts::supports_remainder_assignment<T>
+        noexcept(noexcept(lhs.m_value %= rhs.m_value))
+        requires concepts::supports_remainder_assignment<T> && (!is_overflow_aware)
     {
         lhs.m_value %= rhs.m_value;
         return lhs;
     }
 
     constexpr friend reference operator&=(reference lhs, const_reference_like rhs)
+        noexcept(noexcept(lhs.m_value &= rhs.m_value))
         requires concepts::supports_bitwise_and_assignment<T>
     {
         lhs.m_value &= rhs.m_value;
@@ -214,6 +468,7 @@ public:
     }
 
     constexpr friend reference operator|=(reference lhs, const_reference_like rhs)
+        noexcept(noexcept(lhs.m_value |= rhs.m_value))
         requires concepts::supports_bitwise_or_assignment<T>
     {
         lhs.m_value |= rhs.m_value;
@@ -221,6 +476,7 @@ public:
     }
 
     constexpr friend reference operator^=(reference lhs, const_reference_like rhs)
+        noexcept(noexcept(lhs.m_value ^= rhs.m_value))
         requires concepts::supports_bitwise_xor_assignment<T>
     {
         lhs.m_value ^= rhs.m_value;
@@ -228,14 +484,16 @@ public:
     }
 
     constexpr friend reference operator<<=(reference lhs, const_reference_like rhs)
-        requires concepts::supports_bitwise_left_shift_assignment<T>
+        noexcept(noexcept(lhs.m_value <<= rhs.m_value))
+        requires concepts::supports_bitwise_left_shift_assignment<T> && (!is_overflow_aware)
     {
         lhs.m_value <<= rhs.m_value;
         return lhs;
     }
 
     constexpr friend reference operator>>=(reference lhs, const_reference_like rhs)
-        requires concepts::supports_bitwise_right_shift_assignment<T>
+        noexcept(noexcept(lhs.m_value >>= rhs.m_value))
+        requires concepts::supports_bitwise_right_shift_assignment<T> && (!is_overflow_aware)
     {
         lhs.m_value >>= rhs.m_value;
         return lhs;
@@ -244,78 +502,243 @@ public:
     // Increment and decrement operators ...............................................................................
 
     constexpr reference operator++()
-        requires concepts::supports_pre_increment<T>
+        noexcept(noexcept(++m_value))
+        requires concepts::supports_pre_increment<T> && (!is_overflow_aware)
     {
         ++m_value;
         return *this;
     }
 
     constexpr reference operator--()
-        requires concepts::supports_pre_decrement<T>
+        noexcept(noexcept(--m_value))
+        requires concepts::supports_pre_decrement<T> && (!is_overflow_aware)
     {
         --m_value;
         return *this;
     }
 
     constexpr strong_type operator++(int)
-        requires concepts::supports_post_increment<T>
+        noexcept(noexcept(strong_type{ m_value++ }))
+        requires concepts::supports_post_increment<T> && (!is_overflow_aware)
     {
         return strong_type{ m_value++ };
     }
 
     constexpr strong_type operator--(int)
-        requires concepts::supports_post_decrement<T>
+        noexcept(noexcept(strong_type{ m_value-- }))
+        requires concepts::supports_post_decrement<T> && (!is_overflow_aware)
     {
         return strong_type{ m_value-- };
     }
 
+    // Overflow-aware arithmetic operators .............................................................................
+    // Replace the inherited ones for integers with options::checked_arithmetic or options::saturating_arithmetic.
+    // See stronger/overflow.hpp. They are templates, so that they don't redeclare the inherited ones with other constraints.
+
+    template <std::same_as<strong_type> Operand>
+    [[nodiscard]] constexpr friend strong_type operator-(const Operand rhs) noexcept(is_nothrow_overflow_aware)
+        requires is_overflow_aware
+    {
+        return strong_type{ overflow_arithmetic::minus(T{ 0 }, rhs.m_value) };
+    }
+
+    template <typename Lhs, typename Rhs>
+    [[nodiscard]] constexpr friend strong_type operator+(const Lhs& lhs, const Rhs& rhs)
+        noexcept(is_nothrow_overflow_aware)
+        requires is_overflow_aware_operation<Lhs, Rhs> && (!is_rebound<operations::addition>)
+    {
+        return strong_type{ overflow_arithmetic::plus(value_of(lhs), value_of(rhs)) };
+    }
+
+    template <typename Lhs, typename Rhs>
+    [[nodiscard]] constexpr friend strong_type operator-(const Lhs& lhs, const Rhs& rhs)
+        noexcept(is_nothrow_overflow_aware)
+        requires is_overflow_aware_operation<Lhs, Rhs> && (!is_rebound<operations::subtraction>)
+    {
+        return strong_type{ overflow_arithmetic::minus(value_of(lhs), value_of(rhs)) };
+    }
+
+    template <typename Lhs, typename Rhs>
+    [[nodiscard]] constexpr friend strong_type operator*(const Lhs& lhs, const Rhs& rhs)
+        noexcept(is_nothrow_overflow_aware)
+        requires is_overflow_aware_operation<Lhs, Rhs> && (!is_rebound<operations::multiplication>)
+    {
+        return strong_type{ overflow_arithmetic::multiplies(value_of(lhs), value_of(rhs)) };
+    }
+
+    template <typename Lhs, typename Rhs>
+    [[nodiscard]] constexpr friend strong_type operator/(const Lhs& lhs, const Rhs& rhs)
+        noexcept(is_nothrow_overflow_aware)
+        requires is_overflow_aware_operation<Lhs, Rhs> && (!is_rebound<operations::division>)
+    {
+        return strong_type{ overflow_arithmetic::divides(value_of(lhs), value_of(rhs)) };
+    }
+
+    template <typename Lhs, typename Rhs>
+    [[nodiscard]] constexpr friend strong_type operator%(const Lhs& lhs, const Rhs& rhs)
+        noexcept(is_nothrow_overflow_aware)
+        requires is_overflow_aware_operation<Lhs, Rhs> && (!is_rebound<operations::remainder>)
+    {
+        return strong_type{ overflow_arithmetic::modulus(value_of(lhs), value_of(rhs)) };
+    }
+
+    template <typename Lhs, typename Rhs>
+    [[nodiscard]] constexpr friend strong_type operator<<(const Lhs& lhs, const Rhs& rhs)
+        noexcept(is_nothrow_overflow_aware)
+        requires is_overflow_aware_operation<Lhs, Rhs>
+    {
+        return strong_type{ overflow_arithmetic::left_shift(value_of(lhs), value_of(rhs)) };
+    }
+
+    template <typename Lhs, typename Rhs>
+    [[nodiscard]] constexpr friend strong_type operator>>(const Lhs& lhs, const Rhs& rhs)
+        noexcept(is_nothrow_overflow_aware)
+        requires is_overflow_aware_operation<Lhs, Rhs>
+    {
+        return strong_type{ overflow_arithmetic::right_shift(value_of(lhs), value_of(rhs)) };
+    }
+
+    template <typename Rhs>
+    constexpr friend reference operator+=(reference lhs, const Rhs& rhs) noexcept(is_nothrow_overflow_aware)
+        requires is_overflow_aware_operation<strong_type, Rhs>
+    {
+        lhs.m_value = overflow_arithmetic::plus(lhs.m_value, value_of(rhs));
+        return lhs;
+    }
+
+    template <typename Rhs>
+    constexpr friend reference operator-=(reference lhs, const Rhs& rhs) noexcept(is_nothrow_overflow_aware)
+        requires is_overflow_aware_operation<strong_type, Rhs>
+    {
+        lhs.m_value = overflow_arithmetic::minus(lhs.m_value, value_of(rhs));
+        return lhs;
+    }
+
+    template <typename Rhs>
+    constexpr friend reference operator*=(reference lhs, const Rhs& rhs) noexcept(is_nothrow_overflow_aware)
+        requires is_overflow_aware_operation<strong_type, Rhs>
+    {
+        lhs.m_value = overflow_arithmetic::multiplies(lhs.m_value, value_of(rhs));
+        return lhs;
+    }
+
+    template <typename Rhs>
+    constexpr friend reference operator/=(reference lhs, const Rhs& rhs) noexcept(is_nothrow_overflow_aware)
+        requires is_overflow_aware_operation<strong_type, Rhs>
+    {
+        lhs.m_value = overflow_arithmetic::divides(lhs.m_value, value_of(rhs));
+        return lhs;
+    }
+
+    template <typename Rhs>
+    constexpr friend reference operator%=(reference lhs, const Rhs& rhs) noexcept(is_nothrow_overflow_aware)
+        requires is_overflow_aware_operation<strong_type, Rhs>
+    {
+        lhs.m_value = overflow_arithmetic::modulus(lhs.m_value, value_of(rhs));
+        return lhs;
+    }
+
+    template <typename Rhs>
+    constexpr friend reference operator<<=(reference lhs, const Rhs& rhs) noexcept(is_nothrow_overflow_aware)
+        requires is_overflow_aware_operation<strong_type, Rhs>
+    {
+        lhs.m_value = overflow_arithmetic::left_shift(lhs.m_value, value_of(rhs));
+        return lhs;
+    }
+
+    template <typename Rhs>
+    constexpr friend reference operator>>=(reference lhs, const Rhs& rhs) noexcept(is_nothrow_overflow_aware)
+        requires is_overflow_aware_operation<strong_type, Rhs>
+    {
+        lhs.m_value = overflow_arithmetic::right_shift(lhs.m_value, value_of(rhs));
+        return lhs;
+    }
+
+    constexpr reference operator++() noexcept(is_nothrow_overflow_aware)
+        requires is_overflow_aware
+    {
+        m_value = overflow_arithmetic::plus(m_value, T{ 1 });
+        return *this;
+    }
+
+    constexpr reference operator--() noexcept(is_nothrow_overflow_aware)
+        requires is_overflow_aware
+    {
+        m_value = overflow_arithmetic::minus(m_value, T{ 1 });
+        return *this;
+    }
+
+    constexpr strong_type operator++(int) noexcept(is_nothrow_overflow_aware)
+        requires is_overflow_aware
+    {
+        const strong_type previous = *this;
+        ++*this;
+        return previous;
+    }
+
+    constexpr strong_type operator--(int) noexcept(is_nothrow_overflow_aware)
+        requires is_overflow_aware
+    {
+        const strong_type previous = *this;
+        --*this;
+        return previous;
+    }
+
     // Comparison operators ............................................................................................
 
-    [[nodiscard]] constexpr friend bool operator==(const_reference_like lhs, const_reference_like rhs)
-        requires concepts::supports_equal_to<T>
+    [[nodiscard]] constexpr friend auto operator==(const_reference_like lhs, const_reference_like rhs)
+        noexcept(noexcept(lhs.m_value == rhs.m_value))
+        requires concepts::supports_equal_to<T> && (!is_rebound<operations::equal_to>)
     {
         return lhs.m_value == rhs.m_value;
     }
 
-    [[nodiscard]] constexpr friend bool operator!=(const_reference_like lhs, const_reference_like rhs)
-        requires concepts::supports_not_equal_to<T>
+    [[nodiscard]] constexpr friend auto operator!=(const_reference_like lhs, const_reference_like rhs)
+        noexcept(noexcept(lhs.m_value != rhs.m_value))
+        requires concepts::supports_not_equal_to<T> && (!is_rebound<operations::not_equal_to>)
     {
         return lhs.m_value != rhs.m_value;
     }
 
-    [[nodiscard]] constexpr friend bool operator<(const_reference_like lhs, const_reference_like rhs)
-        requires concepts::supports_less_than<T>
+    [[nodiscard]] constexpr friend auto operator<(const_reference_like lhs, const_reference_like rhs)
+        noexcept(noexcept(lhs.m_value < rhs.m_value))
+        requires concepts::supports_less_than<T> && (!is_rebound<operations::less_than>)
     {
         return lhs.m_value < rhs.m_value;
     }
 
-    [[nodiscard]] constexpr friend bool operator>(const_reference_like lhs, const_reference_like rhs)
-        requires concepts::supports_greater_than<T>
+    [[nodiscard]] constexpr friend auto operator>(const_reference_like lhs, const_reference_like rhs)
+        noexcept(noexcept(lhs.m_value > rhs.m_value))
+        requires concepts::supports_greater_than<T> && (!is_rebound<operations::greater_than>)
     {
         return lhs.m_value > rhs.m_value;
     }
 
-    [[nodiscard]] constexpr friend bool operator<=(const_reference_like lhs, const_reference_like rhs)
-        requires concepts::supports_less_than_or_equal_to<T>
+    [[nodiscard]] constexpr friend auto operator<=(const_reference_like lhs, const_reference_like rhs)
+        noexcept(noexcept(lhs.m_value <= rhs.m_value))
+        requires concepts::supports_less_than_or_equal_to<T> && (!is_rebound<operations::less_than_or_equal_to>)
     {
         return lhs.m_value <= rhs.m_value;
     }
 
-    [[nodiscard]] constexpr friend bool operator>=(const_reference_like lhs, const_reference_like rhs)
-        requires concepts::supports_greater_than_or_equal_to<T>
+    [[nodiscard]] constexpr friend auto operator>=(const_reference_like lhs, const_reference_like rhs)
+        noexcept(noexcept(lhs.m_value >= rhs.m_value))
+        requires concepts::supports_greater_than_or_equal_to<T> && (!is_rebound<operations::greater_than_or_equal_to>)
     {
         return lhs.m_value >= rhs.m_value;
     }
 
     [[nodiscard]] constexpr friend auto operator<=>(const_reference_like lhs, const_reference_like rhs)
-        requires concepts::supports_three_way_comparison<T>
+        noexcept(noexcept(lhs.m_value <=> rhs.m_value))
+        requires concepts::supports_three_way_comparison<T> && (!is_rebound<operations::three_way_comparison>)
     {
         return lhs.m_value <=> rhs.m_value;
     }
 
     // Logical operators ...............................................................................................
 
-    [[nodiscard]] constexpr friend bool operator!(const_reference_like rhs)
+    [[nodiscard]] constexpr friend auto operator!(const_reference_like rhs)
+        noexcept(noexcept(!rhs.m_value))
         requires concepts::supports_negation<T>
     {
         return !rhs.m_value;
@@ -328,6 +751,7 @@ public:
 
     template <typename... Args>
     [[nodiscard]] static constexpr decltype(auto) operator()(Args&&... args)
+        noexcept(noexcept(underlying_type::operator()(std::forward<Args>(args)...)))
         requires concepts::supports_static_call<underlying_type, Args...>
     {
         return underlying_type::operator()(std::forward<Args>(args)...);
@@ -335,6 +759,7 @@ public:
 
     template <typename... Args>
     [[nodiscard]] constexpr decltype(auto) operator()(this auto&& self, Args&&... args)
+        noexcept(noexcept(self.m_value(std::forward<Args>(args)...)))
         requires concepts::supports_non_static_call<underlying_type, Args...>
     {
         return self.m_value(std::forward<Args>(args)...);
@@ -342,6 +767,7 @@ public:
 
     template <typename... Args>
     [[nodiscard]] static constexpr decltype(auto) operator[](Args&&... args)
+        noexcept(noexcept(underlying_type::operator[](std::forward<Args>(args)...)))
         requires concepts::supports_static_subscript<underlying_type, Args...>
     {
         return underlying_type::operator[](std::forward<Args>(args)...);
@@ -349,26 +775,21 @@ public:
 
     template <typename... Args>
     [[nodiscard]] constexpr decltype(auto) operator[](this auto&& self, Args&&... args)
+        noexcept(noexcept(self.m_value[std::forward<Args>(args)...]))
         requires concepts::supports_non_static_subscript<underlying_type, Args...>
     {
         return self.m_value[std::forward<Args>(args)...];
     }
 
-    // Ostream insertion ...............................................................................................
-
-    constexpr friend std::ostream& operator<<(std::ostream& os, const_reference_like rhs)
-        requires concepts::supports_ostream_insertion<T>
-    {
-        return os << rhs.m_value;
-    }
-
     [[nodiscard]] constexpr decltype(auto) begin(this auto&& self)
+        noexcept(noexcept(std::forward<decltype(self)>(self).m_value.begin()))
         requires concepts::supports_begin<T>
     {
         return std::forward<decltype(self)>(self).m_value.begin();
     }
 
     [[nodiscard]] constexpr decltype(auto) end(this auto&& self)
+        noexcept(noexcept(std::forward<decltype(self)>(self).m_value.end()))
         requires concepts::supports_end<T>
     {
         return std::forward<decltype(self)>(self).m_value.end();
@@ -422,23 +843,140 @@ template <template <typename T> class StrongType, typename T>
     return StrongType<T>{ std::forward<T>(value) };
 }
 
-}  // namespace stronger
+namespace internal
+{
 
-template <stronger::concepts::supports_std_format T, size_t Tag, stronger::options... Options>
-struct std::formatter<stronger::strong_type<T, Tag, Options...>> : std::formatter<T>
+/// Underlying value of strong types, other values unchanged
+template <typename T>
+[[nodiscard]] constexpr decltype(auto) unwrap(const T& value) noexcept
 {
-    auto format(const stronger::strong_type<T, Tag, Options...>& s, std::format_context& ctx) const
-    {
-        return std::formatter<T>::format(*s, ctx);
-    }
-};
+    if constexpr(traits::is_strong_type<T>)
+        return *value;
+    else
+        return value;
+}
+
+/// At least one operand is a strong type, and `Operation` is bound between them
+template <typename Operation, typename Lhs, typename Rhs>
+concept bound_operands =
+    (traits::is_strong_type<Lhs> || traits::is_strong_type<Rhs>) && traits::is_bound<Operation, Lhs, Rhs>;
+
+/// Bound comparison whose result can be tested as a condition
+template <typename Operation, typename Lhs, typename Rhs>
+concept bound_comparison =
+    bound_operands<Operation, Lhs, Rhs> && std::convertible_to<traits::binding_result<Operation, Lhs, Rhs>, bool>;
 
-template <stronger::concepts::supports_std_hash T, size_t Tag, stronger::options... Options>
-struct std::hash<stronger::strong_type<T, Tag, Options...>>
+/// Bound equality resulting in `bool`, as it is also a rewritten candidate for `!=`, which requires exactly `bool`
+template <typename Lhs, typename Rhs>
+concept bound_equality = bound_comparison<operations::equal_to, Lhs, Rhs> &&
+                         std::same_as<traits::binding_result<operations::equal_to, Lhs, Rhs>, bool>;
+
+template <typename Operation, typename Lhs, typename Rhs>
+[[nodiscard]] constexpr traits::binding_result<Operation, Lhs, Rhs> apply_binding(const Lhs& lhs, const Rhs& rhs)
+    noexcept(noexcept(traits::binding_result<Operation, Lhs, Rhs>{ Operation{}(unwrap(lhs), unwrap(rhs)) }))
 {
-    constexpr hash() = default;
-    static constexpr auto operator()(const stronger::strong_type<T, Tag, Options...>& s) noexcept
-    {
-        return std::hash<T>{}(*s);
-    }
-};
+    return traits::binding_result<Operation, Lhs, Rhs>{ Operation{}(unwrap(lhs), unwrap(rhs)) };
+}
+
+}  // namespace internal
+
+// Bound operators _____________________________________________________________________________________________________
+// Operators declared by specializations of stronger::binding. See traits/binding.hpp.
+
+template <typename Lhs, typename Rhs>
+    requires internal::bound_operands<operations::addition, Lhs, Rhs>
+[[nodiscard]] constexpr decltype(auto) operator+(const Lhs& lhs, const Rhs& rhs)
+    noexcept(noexcept(internal::apply_binding<operations::addition>(lhs, rhs)))
+{
+    return internal::apply_binding<operations::addition>(lhs, rhs);
+}
+
+template <typename Lhs, typename Rhs>
+    requires internal::bound_operands<operations::subtraction, Lhs, Rhs>
+[[nodiscard]] constexpr decltype(auto) operator-(const Lhs& lhs, const Rhs& rhs)
+    noexcept(noexcept(internal::apply_binding<operations::subtraction>(lhs, rhs)))
+{
+    return internal::apply_binding<operations::subtraction>(lhs, rhs);
+}
+
+template <typename Lhs, typename Rhs>
+    requires internal::bound_operands<operations::multiplication, Lhs, Rhs>
+[[nodiscard]] constexpr decltype(auto) operator*(const Lhs& lhs, const Rhs& rhs)
+    noexcept(noexcept(internal::apply_binding<operations::multiplication>(lhs, rhs)))
+{
+    return internal::apply_binding<operations::multiplication>(lhs, rhs);
+}
+
+template <typename Lhs, typename Rhs>
+    requires internal::bound_operands<operations::division, Lhs, Rhs>
+[[nodiscard]] constexpr decltype(auto) operator/(const Lhs& lhs, const Rhs& rhs)
+    noexcept(noexcept(internal::apply_binding<operations::division>(lhs, rhs)))
+{
+    return internal::apply_binding<operations::division>(lhs, rhs);
+}
+
+template <typename Lhs, typename Rhs>
+    requires internal::bound_operands<operations::remainder, Lhs, Rhs>
+[[nodiscard]] constexpr decltype(auto) operator%(const Lhs& lhs, const Rhs& rhs)
+    noexcept(noexcept(internal::apply_binding<operations::remainder>(lhs, rhs)))
+{
+    return internal::apply_binding<operations::remainder>(lhs, rhs);
+}
+
+template <typename Lhs, typename Rhs>
+    requires internal::bound_equality<Lhs, Rhs>
+[[nodiscard]] constexpr decltype(auto) operator==(const Lhs& lhs, const Rhs& rhs)
+    noexcept(noexcept(internal::apply_binding<operations::equal_to>(lhs, rhs)))
+{
+    return internal::apply_binding<operations::equal_to>(lhs, rhs);
+}
+
+template <typename Lhs, typename Rhs>
+    requires internal::bound_comparison<operations::not_equal_to, Lhs, Rhs>
+[[nodiscard]] constexpr decltype(auto) operator!=(const Lhs& lhs, const Rhs& rhs)
+    noexcept(noexcept(internal::apply_binding<operations::not_equal_to>(lhs, rhs)))
+{
+    return internal::apply_binding<operations::not_equal_to>(lhs, rhs);
+}
+
+template <typename Lhs, typename Rhs>
+    requires internal::bound_comparison<operations::less_than, Lhs, Rhs>
+[[nodiscard]] constexpr decltype(auto) operator<(const Lhs& lhs, const Rhs& rhs)
+    noexcept(noexcept(internal::apply_binding<operations::less_than>(lhs, rhs)))
+{
+    return internal::apply_binding<operations::less_than>(lhs, rhs);
+}
+
+template <typename Lhs, typename Rhs>
+    requires internal::bound_comparison<operations::greater_than, Lhs, Rhs>
+[[nodiscard]] constexpr decltype(auto) operator>(const Lhs& lhs, const Rhs& rhs)
+    noexcept(noexcept(internal::apply_binding<operations::greater_than>(lhs, rhs)))
+{
+    return internal::apply_binding<operations::greater_than>(lhs, rhs);
+}
+
+template <typename Lhs, typename Rhs>
+    requires internal::bound_comparison<operations::less_than_or_equal_to, Lhs, Rhs>
+[[nodiscard]] constexpr decltype(auto) operator<=(const Lhs& lhs, const Rhs& rhs)
+    noexcept(noexcept(internal::apply_binding<operations::less_than_or_equal_to>(lhs, rhs)))
+{
+    return internal::apply_binding<operations::less_than_or_equal_to>(lhs, rhs);
+}
+
+template <typename Lhs, typename Rhs>
+    requires internal::bound_comparison<operations::greater_than_or_equal_to, Lhs, Rhs>
+[[nodiscard]] constexpr decltype(auto) operator>=(const Lhs& lhs, const Rhs& rhs)
+    noexcept(noexcept(internal::apply_binding<operations::greater_than_or_equal_to>(lhs, rhs)))
+{
+    return internal::apply_binding<operations::greater_than_or_equal_to>(lhs, rhs);
+}
+
+template <typename Lhs, typename Rhs>
+    requires internal::bound_operands<operations::three_way_comparison, Lhs, Rhs>
+[[nodiscard]] constexpr decltype(auto) operator<=>(const Lhs& lhs, const Rhs& rhs)
+    noexcept(noexcept(internal::apply_binding<operations::three_way_comparison>(lhs, rhs)))
+{
+    return internal::apply_binding<operations::three_way_comparison>(lhs, rhs);
+}
+
+}  // namespace stronger
@@ -0,0 +1,215 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+// Named module of stronger-cpp, built from stronger.hpp and the opt-in headers of includes/stronger/, except
+// mapped_column.hpp and simd.hpp, which depend on system and experimental headers.
+// Importing it does not give access to macros: STRONG_TYPE and the version macros still require the header.
+
+module;
+#include "stronger.hpp"
+#include "stronger/atomic.hpp"
+#include "stronger/bounded.hpp"
+#include "stronger/charconv.hpp"
+#include "stronger/containers/flat_map.hpp"
+#include "stronger/containers/id_map.hpp"
+#include "stronger/containers/relocating_vector.hpp"
+#include "stronger/containers/soa_vector.hpp"
+#include "stronger/containers/strong_array.hpp"
+#include "stronger/containers/strong_span.hpp"
+#include "stronger/containers/strong_vector.hpp"
+#include "stronger/elementwise.hpp"
+#include "stronger/fixed_string.hpp"
+#include "stronger/interned.hpp"
+#include "stronger/overflow.hpp"
+#include "stronger/point_type.hpp"
+#include "stronger/relocation.hpp"
+#include "stronger/serialization.hpp"
+#include "stronger/span_cast.hpp"
+#include "stronger/transparent_hash.hpp"
+#include "stronger/units.hpp"
+
+export module stronger;
+
+export namespace stronger
+{
+
+using stronger::options;
+using stronger::strong_type;
+using stronger::strong_bool;
+using stronger::weak_bool;
+using stronger::make_strong;
+using stronger::point_type;
+using stronger::bounded;
+using stronger::bounded_type;
+using stronger::bound_policy;
+using stronger::interned;
+using stronger::fixed_string;
+using stronger::fixed_string_type;
+using stronger::tag;
+
+using stronger::strong_vector;
+using stronger::strong_array;
+using stronger::strong_span;
+using stronger::soa_vector;
+using stronger::relocating_vector;
+using stronger::flat_map;
+using stronger::flat_set;
+using stronger::id_map;
+using stronger::is_trivially_relocatable;
+using stronger::is_trivially_relocatable_v;
+using stronger::as_strong_span;
+using stronger::as_underlying_span;
+
+using stronger::char_conversion;
+using stronger::to_chars;
+using stronger::from_chars;
+using stronger::parse;
+
+using stronger::serializer;
+using stronger::serialize;
+using stronger::deserialize;
+
+using stronger::transparent_hash;
+using stronger::transparent_equal_to;
+
+using stronger::elementwise_expression;
+using stronger::operator+;
+using stronger::operator-;
+using stronger::operator*;
+using stronger::operator/;
+using stronger::operator<<;
+using stronger::operator%;
+using stronger::operator==;
+using stronger::operator!=;
+using stronger::operator<;
+using stronger::operator>;
+using stronger::operator<=;
+using stronger::operator>=;
+using stronger::operator<=>;
+
+using stronger::binding;
+
+namespace operations
+{
+
+using stronger::operations::addition;
+using stronger::operations::subtraction;
+using stronger::operations::multiplication;
+using stronger::operations::division;
+using stronger::operations::remainder;
+using stronger::operations::equal_to;
+using stronger::operations::not_equal_to;
+using stronger::operations::less_than;
+using stronger::operations::greater_than;
+using stronger::operations::less_than_or_equal_to;
+using stronger::operations::greater_than_or_equal_to;
+using stronger::operations::three_way_comparison;
+
+}  // namespace operations
+
+namespace traits
+{
+
+using stronger::traits::strong_type_info;
+using stronger::traits::is_strong_type;
+using stronger::traits::point_type_info;
+using stronger::traits::is_point_type;
+using stronger::traits::point_difference;
+using stronger::traits::point_difference_t;
+using stronger::traits::is_bounded;
+using stronger::traits::is_interned;
+using stronger::traits::is_borrowed_view_of;
+using stronger::traits::is_elementwise_expression;
+using stronger::traits::is_bound;
+using stronger::traits::binding_result;
+using stronger::traits::formats_as_string_view;
+using stronger::traits::formats_as_value;
+
+}  // namespace traits
+
+namespace concepts
+{
+
+using stronger::concepts::strong_index;
+using stronger::concepts::borrowed_view_of;
+using stronger::concepts::transparent_key_of;
+using stronger::concepts::atomic_arithmetic;
+using stronger::concepts::elementwise_range;
+using stronger::concepts::elementwise_strong_type;
+using stronger::concepts::elementwise_operand;
+using stronger::concepts::to_chars_convertible;
+using stronger::concepts::from_chars_convertible;
+using stronger::concepts::serializable;
+using stronger::concepts::deserializable;
+
+}  // namespace concepts
+
+namespace units
+{
+
+using stronger::units::dimension;
+using stronger::units::unit;
+using stronger::units::unit_product;
+using stronger::units::unit_quotient;
+using stronger::units::common_unit;
+using stronger::units::quantity;
+using stronger::units::quantity_cast;
+using stronger::units::sqrt;
+using stronger::units::operator+;
+using stronger::units::operator-;
+using stronger::units::operator*;
+using stronger::units::operator/;
+using stronger::units::operator==;
+using stronger::units::operator<=>;
+
+using stronger::units::one;
+using stronger::units::meter;
+using stronger::units::kilometer;
+using stronger::units::millimeter;
+using stronger::units::kilogram;
+using stronger::units::gram;
+using stronger::units::second;
+using stronger::units::millisecond;
+using stronger::units::minute;
+using stronger::units::hour;
+using stronger::units::ampere;
+using stronger::units::kelvin;
+using stronger::units::mole;
+using stronger::units::candela;
+using stronger::units::square_meter;
+using stronger::units::cubic_meter;
+using stronger::units::meter_per_second;
+using stronger::units::meter_per_second_squared;
+using stronger::units::kilometer_per_hour;
+using stronger::units::newton;
+using stronger::units::joule;
+using stronger::units::watt;
+
+using stronger::units::meters;
+using stronger::units::kilometers;
+using stronger::units::millimeters;
+using stronger::units::kilograms;
+using stronger::units::grams;
+using stronger::units::seconds;
+using stronger::units::milliseconds;
+using stronger::units::minutes;
+using stronger::units::hours;
+using stronger::units::square_meters;
+using stronger::units::cubic_meters;
+using stronger::units::meters_per_second;
+using stronger::units::meters_per_second_squared;
+using stronger::units::kilometers_per_hour;
+using stronger::units::newtons;
+using stronger::units::joules;
+using stronger::units::watts;
+
+namespace concepts
+{
+
+using stronger::units::concepts::same_dimension;
+
+}  // namespace concepts
+
+}  // namespace units
+
+}  // namespace stronger
@@ -4,6 +4,9 @@
 #pragma once
 #include "version.hpp"
 #include "strong_type.hpp"
+#include "stronger/format.hpp"
+#include "stronger/hash.hpp"
+#include "stronger/iostream.hpp"
 #include "tag.hpp"
 
 #ifdef STRONGER_CPP_USE_DECLARATION_MACROS
@@ -0,0 +1,292 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+#include "strong_type.hpp"
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <utility>
+
+namespace stronger
+{
+
+namespace concepts
+{
+
+/// Strong types whose underlying type has native atomic read-modify-write operations
+template <typename StrongType>
+concept atomic_arithmetic = traits::is_strong_type<StrongType> &&
+                            (std::integral<typename StrongType::underlying_type> ||
+                             std::floating_point<typename StrongType::underlying_type>);
+
+}  // namespace concepts
+
+namespace internal
+{
+
+/**
+ * Operations shared by std::atomic and std::atomic_ref specializations for strong types.
+ * Every operation forwards to the atomic of the underlying type, and wraps / unwraps the strong type around it.
+ *
+ * Mutating operations deduce `this`, and are constrained to follow the constness rules of the underlying atomic: they
+ * are available on const std::atomic_ref, but not on const std::atomic.
+ *
+ * @tparam StrongType Strong type to operate atomically on
+ * @tparam Atomic std::atomic or std::atomic_ref of StrongType's underlying type
+ */
+template <typename StrongType, typename Atomic>
+class atomic_operations
+{
+    using underlying_type = StrongType::underlying_type;
+    static constexpr bool is_integral = std::integral<underlying_type>;
+
+    /// The underlying atomic can be modified through Self
+    template <typename Self>
+    static constexpr bool is_mutable_through =
+        requires(Self& self, const underlying_type value) { self.m_atomic.store(value); };
+
+public:
+
+    using value_type = StrongType;
+    using difference_type = value_type;
+
+    static constexpr bool is_always_lock_free = Atomic::is_always_lock_free;
+
+    [[nodiscard]] bool is_lock_free() const noexcept { return m_atomic.is_lock_free(); }
+
+    void store(this auto& self, const StrongType desired,
+               const std::memory_order order = std::memory_order_seq_cst) noexcept
+        requires is_mutable_through<decltype(self)>
+    {
+        self.m_atomic.store(*desired, order);
+    }
+
+    [[nodiscard]] StrongType load(const std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return StrongType{ m_atomic.load(order) };
+    }
+
+    operator StrongType() const noexcept { return load(); }
+
+    StrongType exchange(this auto& self, const StrongType desired,
+                        const std::memory_order order = std::memory_order_seq_cst) noexcept
+        requires is_mutable_through<decltype(self)>
+    {
+        return StrongType{ self.m_atomic.exchange(*desired, order) };
+    }
+
+    bool compare_exchange_weak(this auto& self, StrongType& expected, const StrongType desired,
+                               const std::memory_order success, const std::memory_order failure) noexcept
+        requires is_mutable_through<decltype(self)>
+    {
+        return self.m_atomic.compare_exchange_weak(*expected, *desired, success, failure);
+    }
+
+    bool compare_exchange_weak(this auto& self, StrongType& expected, const StrongType desired,
+                               const std::memory_order order = std::memory_order_seq_cst) noexcept
+        requires is_mutable_through<decltype(self)>
+    {
+        return self.m_atomic.compare_exchange_weak(*expected, *desired, order);
+    }
+
+    bool compare_exchange_strong(this auto& self, StrongType& expected, const StrongType desired,
+                                 const std::memory_order success, const std::memory_order failure) noexcept
+        requires is_mutable_through<decltype(self)>
+    {
+        return self.m_atomic.compare_exchange_strong(*expected, *desired, success, failure);
+    }
+
+    bool compare_exchange_strong(this auto& self, StrongType& expected, const StrongType desired,
+                                 const std::memory_order order = std::memory_order_seq_cst) noexcept
+        requires is_mutable_through<decltype(self)>
+    {
+        return self.m_atomic.compare_exchange_strong(*expected, *desired, order);
+    }
+
+    // Arithmetic read-modify-write ____________________________________________________________________________________
+
+    StrongType fetch_add(this auto& self, const StrongType arg,
+                         const std::memory_order order = std::memory_order_seq_cst) noexcept
+        requires is_mutable_through<decltype(self)>
+    {
+        return StrongType{ self.m_atomic.fetch_add(*arg, order) };
+    }
+
+    StrongType fetch_sub(this auto& self, const StrongType arg,
+                         const std::memory_order order = std::memory_order_seq_cst) noexcept
+        requires is_mutable_through<decltype(self)>
+    {
+        return StrongType{ self.m_atomic.fetch_sub(*arg, order) };
+    }
+
+    StrongType operator+=(this auto& self, const StrongType arg) noexcept
+        requires is_mutable_through<decltype(self)>
+    {
+        return StrongType{ self.m_atomic += *arg };
+    }
+
+    StrongType operator-=(this auto& self, const StrongType arg) noexcept
+        requires is_mutable_through<decltype(self)>
+    {
+        return StrongType{ self.m_atomic -= *arg };
+    }
+
+    // Integral only ___________________________________________________________________________________________________
+
+    StrongType operator++(this auto& self) noexcept
+        requires is_integral && is_mutable_through<decltype(self)>
+    {
+        return StrongType{ ++self.m_atomic };
+    }
+
+    StrongType operator++(this auto& self, int) noexcept
+        requires is_integral && is_mutable_through<decltype(self)>
+    {
+        return StrongType{ self.m_atomic++ };
+    }
+
+    StrongType operator--(this auto& self) noexcept
+        requires is_integral && is_mutable_through<decltype(self)>
+    {
+        return StrongType{ --self.m_atomic };
+    }
+
+    StrongType operator--(this auto& self, int) noexcept
+        requires is_integral && is_mutable_through<decltype(self)>
+    {
+        return StrongType{ self.m_atomic-- };
+    }
+
+    StrongType fetch_and(this auto& self, const StrongType arg,
+                         const std::memory_order order = std::memory_order_seq_cst) noexcept
+        requires is_integral && is_mutable_through<decltype(self)>
+    {
+        return StrongType{ self.m_atomic.fetch_and(*arg, order) };
+    }
+
+    StrongType fetch_or(this auto& self, const StrongType arg,
+                        const std::memory_order order = std::memory_order_seq_cst) noexcept
+        requires is_integral && is_mutable_through<decltype(self)>
+    {
+        return StrongType{ self.m_atomic.fetch_or(*arg, order) };
+    }
+
+    StrongType fetch_xor(this auto& self, const StrongType arg,
+                         const std::memory_order order = std::memory_order_seq_cst) noexcept
+        requires is_integral && is_mutable_through<decltype(self)>
+    {
+        return StrongType{ self.m_atomic.fetch_xor(*arg, order) };
+    }
+
+    StrongType operator&=(this auto& self, const StrongType arg) noexcept
+        requires is_integral && is_mutable_through<decltype(self)>
+    {
+        return StrongType{ self.m_atomic &= *arg };
+    }
+
+    StrongType operator|=(this auto& self, const StrongType arg) noexcept
+        requires is_integral && is_mutable_through<decltype(self)>
+    {
+        return StrongType{ self.m_atomic |= *arg };
+    }
+
+    StrongType operator^=(this auto& self, const StrongType arg) noexcept
+        requires is_integral && is_mutable_through<decltype(self)>
+    {
+        return StrongType{ self.m_atomic ^= *arg };
+    }
+
+    // Waiting and notifying ___________________________________________________________________________________________
+
+    void wait(const StrongType old, const std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        m_atomic.wait(*old, order);
+    }
+
+    void notify_one(this auto& self) noexcept
+        requires is_mutable_through<decltype(self)>
+    {
+        self.m_atomic.notify_one();
+    }
+
+    void notify_all(this auto& self) noexcept
+        requires is_mutable_through<decltype(self)>
+    {
+        self.m_atomic.notify_all();
+    }
+
+protected:
+
+    constexpr atomic_operations() noexcept = default;
+
+    template <typename Arg>
+    constexpr explicit atomic_operations(Arg&& arg) noexcept :
+            m_atomic(std::forward<Arg>(arg))
+    {
+    }
+
+    Atomic m_atomic;
+};
+
+}  // namespace internal
+
+}  // namespace stronger
+
+/**
+ * Atomic strong types with integral or floating-point underlying types.
+ * They have the same operations, size and lock-freedom as the atomic of their underlying type.
+ */
+template <typename T, size_t Tag, stronger::options... Options>
+    requires stronger::concepts::atomic_arithmetic<stronger::strong_type<T, Tag, Options...>>
+struct std::atomic<stronger::strong_type<T, Tag, Options...>>
+        : stronger::internal::atomic_operations<stronger::strong_type<T, Tag, Options...>, std::atomic<T>>
+{
+    using strong_type = stronger::strong_type<T, Tag, Options...>;
+    using base = stronger::internal::atomic_operations<strong_type, std::atomic<T>>;
+
+    constexpr atomic() noexcept = default;
+
+    constexpr atomic(const strong_type desired) noexcept :
+            base(*desired)
+    {
+    }
+
+    atomic(const atomic&) = delete;
+    atomic& operator=(const atomic&) = delete;
+
+    strong_type operator=(const strong_type desired) noexcept
+    {
+        this->store(desired);
+        return desired;
+    }
+};
+
+/**
+ * Atomic references to strong types with integral or floating-point underlying types.
+ * They have the same operations and lock-freedom as the atomic_ref of their underlying type.
+ */
+template <typename T, size_t Tag, stronger::options... Options>
+    requires stronger::concepts::atomic_arithmetic<stronger::strong_type<T, Tag, Options...>>
+struct std::atomic_ref<stronger::strong_type<T, Tag, Options...>>
+        : stronger::internal::atomic_operations<stronger::strong_type<T, Tag, Options...>, std::atomic_ref<T>>
+{
+    using strong_type = stronger::strong_type<T, Tag, Options...>;
+    using base = stronger::internal::atomic_operations<strong_type, std::atomic_ref<T>>;
+
+    static constexpr size_t required_alignment = std::atomic_ref<T>::required_alignment;
+
+    explicit atomic_ref(strong_type& object) noexcept :
+            base(*object)
+    {
+    }
+
+    atomic_ref(const atomic_ref&) noexcept = default;
+    atomic_ref& operator=(const atomic_ref&) = delete;
+
+    strong_type operator=(const strong_type desired) const noexcept
+    {
+        this->store(desired);
+        return desired;
+    }
+};
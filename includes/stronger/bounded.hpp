@@ -0,0 +1,468 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+#include "strong_type.hpp"
+#include "stronger/overflow.hpp"
+#include "traits/traits.hpp"
+#include <cassert>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+namespace stronger
+{
+
+/// What bounded types do with values out of their bounds
+enum class bound_policy
+{
+    unchecked,        // Nothing: values are assumed to be in bounds. Same code as the underlying type
+    saturate,         // Values are clamped to the bounds
+    wrap,             // Integers only: values wrap around, as if the bounds were the range of an unsigned integer
+    assert_in_debug,  // assert(), which disappears with NDEBUG
+    throw_exception,  // std::out_of_range is thrown. It fails compilation in constant expressions
+};
+
+template <typename T, T Min, T Max, bound_policy Policy>
+    requires std::is_arithmetic_v<T> && (Min <= Max)
+class bounded;
+
+namespace traits
+{
+
+template <typename T>
+constexpr bool is_bounded_impl = false;
+
+template <typename T, T Min, T Max, bound_policy Policy>
+constexpr bool is_bounded_impl<bounded<T, Min, Max, Policy>> = true;
+
+template <typename T>
+constexpr bool is_bounded = is_bounded_impl<std::remove_cvref_t<T>>;
+
+}  // namespace traits
+
+/**
+ * Arithmetic value in [Min, Max], like a percentage or a port number. Use bounded_type to make it a strong type.
+ * Construction and every operation apply `Policy` to their result, which is computed in int64_t for integers of
+ * less than 64 bits, so that intermediate results can't overflow. 64-bit integers are computed in their own type, with
+ * their overflows detected, and floating-point values in their own type.
+ *
+ * Checks only depend on the result of each operation: they fold away when operands are constant, and
+ * bound_policy::saturate is a branchless clamp. Bounded types covering the whole range of T are not checked with
+ * bound_policy::unchecked and bound_policy::wrap, since wrapping around their range is what T does.
+ * The underlying value is only accessible as const, so that it can't be modified without checks.
+ *
+ * @tparam T Arithmetic type
+ * @tparam Min Smallest value, included
+ * @tparam Max Greatest value, included
+ * @tparam Policy What to do with values out of bounds
+ */
+template <typename T, T Min, T Max, bound_policy Policy>
+    requires std::is_arithmetic_v<T> && (Min <= Max)
+class bounded
+{
+    using intermediate_type =
+        std::conditional_t<std::integral<T> && (sizeof(T) < sizeof(int64_t)), int64_t, std::remove_cv_t<T>>;
+
+    static constexpr intermediate_type low = internal::cast<intermediate_type>(Min);
+    static constexpr intermediate_type high = internal::cast<intermediate_type>(Max);
+    // 64-bit integers can't be widened: their operations detect overflows instead
+    static constexpr bool is_computed_in_t = std::integral<T> && std::same_as<intermediate_type, std::remove_cv_t<T>>;
+    static constexpr bool is_full_range =
+        is_computed_in_t && Min == std::numeric_limits<T>::lowest() && Max == std::numeric_limits<T>::max();
+    static constexpr bool is_nothrow = Policy != bound_policy::throw_exception;
+    // Integers that convert to intermediate_type without loss: they are checked before being narrowed to T
+    template <typename U>
+    static constexpr bool is_widened_from =
+        std::integral<T> && std::integral<U> && !std::same_as<U, bool> &&
+        (std::is_signed_v<intermediate_type>
+             ? sizeof(U) < sizeof(intermediate_type) || (std::is_signed_v<U> && sizeof(U) == sizeof(intermediate_type))
+             : std::is_unsigned_v<U> && sizeof(U) <= sizeof(intermediate_type));
+
+    static_assert(Policy != bound_policy::wrap || std::integral<T>, "stronger: bound_policy::wrap requires integers");
+
+    /// Already in bounds: not checked again
+    struct trusted_t
+    {
+    };
+
+    constexpr bounded(trusted_t, const T value) noexcept :
+            m_value(value)
+    {
+    }
+
+    [[nodiscard]] static constexpr intermediate_type widen(const T value) noexcept
+    {
+        return internal::cast<intermediate_type>(value);
+    }
+
+    [[nodiscard]] static constexpr T enforce(const intermediate_type value) noexcept(is_nothrow)
+    {
+        if constexpr(Policy == bound_policy::unchecked || (Policy == bound_policy::wrap && is_full_range))
+            return internal::cast<T>(value);
+        else if constexpr(Policy == bound_policy::saturate)
+            return internal::cast<T>(value < low ? low : (value > high ? high : value));
+        else if constexpr(Policy == bound_policy::wrap)
+        {
+            // Computed in unsigned arithmetic, which is well defined for any 64-bit range
+            using unsigned_type = std::make_unsigned_t<intermediate_type>;
+            constexpr auto as_unsigned = [](const intermediate_type v) { return internal::cast<unsigned_type>(v); };
+            constexpr auto size = internal::cast<unsigned_type>(as_unsigned(high) - as_unsigned(low) + 1U);
+            const auto offset =
+                value < low
+                    ? internal::cast<unsigned_type>((size - (as_unsigned(low) - as_unsigned(value)) % size) % size)
+                    : internal::cast<unsigned_type>((as_unsigned(value) - as_unsigned(low)) % size);
+            return internal::cast<T>(internal::cast<intermediate_type>(as_unsigned(low) + offset));
+        }
+        else if constexpr(Policy == bound_policy::assert_in_debug)
+        {
+            assert(low <= value && value <= high && "stronger: bounded value out of bounds");
+            return internal::cast<T>(value);
+        }
+        else
+        {
+            if(value < low || value > high)
+                throw std::out_of_range("stronger: bounded value out of bounds");
+            return internal::cast<T>(value);
+        }
+    }
+
+    // 64-bit integers .................................................................................................
+
+    /**
+     * Applies `Policy` to a result computed in T
+     *
+     * @param overflowed_to std::numeric_limits<T>::min() or max(), on the side of the exact result if it overflowed
+     */
+    [[nodiscard]] static constexpr T enforce(const internal::overflow::result<T> result,
+                                             const T overflowed_to) noexcept(is_nothrow)
+    {
+        if(!result.overflowed)
+            return enforce(result.value);
+        const bool is_above = overflowed_to == std::numeric_limits<T>::max();
+        if constexpr(Policy == bound_policy::unchecked)
+            return result.value;
+        else if constexpr(Policy == bound_policy::saturate)
+            return is_above ? Max : Min;
+        else if constexpr(Policy == bound_policy::assert_in_debug)
+        {
+            assert(false && "stronger: bounded value out of bounds");
+            return result.value;
+        }
+        else
+            throw std::out_of_range("stronger: bounded value out of bounds");
+    }
+
+    // bound_policy::wrap computes the residues of the values modulo the size of the range, which are exact even when
+    // the operation overflows T. A size of 0 stands for 2^64: the arithmetic of unsigned integers
+    using residue_type = std::make_unsigned_t<std::conditional_t<is_computed_in_t, intermediate_type, int64_t>>;
+    static constexpr residue_type range_size = []
+    {
+        if constexpr(is_computed_in_t)
+            return internal::cast<residue_type>(internal::cast<residue_type>(high) - internal::cast<residue_type>(low) +
+                                                1U);
+        else
+            return residue_type{ 0 };
+    }();
+
+    [[nodiscard]] static constexpr residue_type add_residues(const residue_type lhs, const residue_type rhs) noexcept
+    {
+        if constexpr(range_size == 0)
+            return internal::cast<residue_type>(lhs + rhs);
+        else
+            return lhs >= range_size - rhs ? lhs - (range_size - rhs) : lhs + rhs;
+    }
+
+    [[nodiscard]] static constexpr residue_type subtract_residues(const residue_type lhs,
+                                                                  const residue_type rhs) noexcept
+    {
+        if constexpr(range_size == 0)
+            return internal::cast<residue_type>(lhs - rhs);
+        else
+            return lhs >= rhs ? lhs - rhs : lhs + (range_size - rhs);
+    }
+
+    /// Doubles and adds, so that products never exceed 64 bits
+    [[nodiscard]] static constexpr residue_type multiply_residues(residue_type lhs, residue_type rhs) noexcept
+    {
+        if constexpr(range_size == 0)
+            return internal::cast<residue_type>(lhs * rhs);
+        else
+        {
+            residue_type product = 0;
+            for(; rhs != 0; rhs >>= 1)
+            {
+                if((rhs & 1U) != 0)
+                    product = add_residues(product, lhs);
+                lhs = add_residues(lhs, lhs);
+            }
+            return product;
+        }
+    }
+
+    [[nodiscard]] static constexpr residue_type residue(const T value) noexcept
+    {
+        const auto bits = internal::cast<residue_type>(value);
+        if constexpr(range_size == 0)
+            return bits;
+        else
+        {
+            // Negative values are their bits minus 2^64
+            constexpr auto wrapped_size = internal::cast<residue_type>(residue_type{ 0 } - range_size) % range_size;
+            return internal::overflow::is_negative(value) ? subtract_residues(bits % range_size, wrapped_size)
+                                                          : bits % range_size;
+        }
+    }
+
+    /// The value in bounds that has this residue
+    [[nodiscard]] static constexpr T from_residue(const residue_type value) noexcept
+    {
+        constexpr residue_type low_bits = internal::cast<residue_type>(low);
+        return internal::cast<T>(internal::cast<residue_type>(low_bits + subtract_residues(value, residue(Min))));
+    }
+
+    // Operations ......................................................................................................
+
+    [[nodiscard]] static constexpr T negate(const T value) noexcept(is_nothrow)
+    {
+        if constexpr(!is_computed_in_t)
+            return enforce(-widen(value));
+        else if constexpr(Policy == bound_policy::wrap)
+            return from_residue(subtract_residues(0, residue(value)));
+        else
+            return enforce(internal::overflow::subtract(T{ 0 }, value),
+                           internal::overflow::saturated_difference(value));
+    }
+
+    [[nodiscard]] static constexpr T add(const T lhs, const T rhs) noexcept(is_nothrow)
+    {
+        if constexpr(!is_computed_in_t)
+            return enforce(widen(lhs) + widen(rhs));
+        else if constexpr(Policy == bound_policy::wrap)
+            return from_residue(add_residues(residue(lhs), residue(rhs)));
+        else
+            return enforce(internal::overflow::add(lhs, rhs), internal::overflow::saturated_sum(rhs));
+    }
+
+    [[nodiscard]] static constexpr T subtract(const T lhs, const T rhs) noexcept(is_nothrow)
+    {
+        if constexpr(!is_computed_in_t)
+            return enforce(widen(lhs) - widen(rhs));
+        else if constexpr(Policy == bound_policy::wrap)
+            return from_residue(subtract_residues(residue(lhs), residue(rhs)));
+        else
+            return enforce(internal::overflow::subtract(lhs, rhs), internal::overflow::saturated_difference(rhs));
+    }
+
+    [[nodiscard]] static constexpr T multiply(const T lhs, const T rhs) noexcept(is_nothrow)
+    {
+        if constexpr(!is_computed_in_t)
+            return enforce(widen(lhs) * widen(rhs));
+        else if constexpr(Policy == bound_policy::wrap)
+            return from_residue(multiply_residues(residue(lhs), residue(rhs)));
+        else
+            return enforce(internal::overflow::multiply(lhs, rhs), internal::overflow::saturated_product(lhs, rhs));
+    }
+
+    /// Only std::numeric_limits<T>::min() / -1 overflows, to -std::numeric_limits<T>::min()
+    [[nodiscard]] static constexpr T divide(const T lhs, const T rhs) noexcept(is_nothrow)
+    {
+        if constexpr(!is_computed_in_t)
+            return enforce(widen(lhs) / widen(rhs));
+        else
+        {
+            const internal::overflow::result<T> quotient = internal::overflow::divide(lhs, rhs);
+            if constexpr(Policy == bound_policy::wrap)
+                return from_residue(quotient.overflowed ? subtract_residues(0, residue(lhs)) : residue(quotient.value));
+            else
+                return enforce(quotient, std::numeric_limits<T>::max());
+        }
+    }
+
+    [[nodiscard]] static constexpr T remainder(const T lhs, const T rhs) noexcept(is_nothrow)
+    {
+        if constexpr(!is_computed_in_t)
+            return enforce(widen(lhs) % widen(rhs));
+        else
+            return enforce(internal::overflow::remainder(lhs, rhs).value);
+    }
+
+public:
+
+    using underlying_type = T;
+    static constexpr T min = Min;
+    static constexpr T max = Max;
+    static constexpr bound_policy policy = Policy;
+
+    /// Holds Min
+    constexpr bounded() noexcept :
+            m_value(Min)
+    {
+    }
+
+    constexpr explicit bounded(const T value) noexcept(is_nothrow) :
+            m_value(enforce(widen(value)))
+    {
+    }
+
+    /// Integers of other types are checked before being converted, so that they can't wrap around T first
+    template <typename U>
+        requires(!std::same_as<U, T>) && is_widened_from<U>
+    constexpr explicit bounded(const U value) noexcept(is_nothrow) :
+            m_value(enforce(internal::cast<intermediate_type>(value)))
+    {
+    }
+
+    /// Checks `Value` at compile time, whatever the policy
+    template <T Value>
+        requires(Min <= Value && Value <= Max)
+    [[nodiscard]] static consteval bounded from_constant() noexcept
+    {
+        return bounded{ trusted_t{}, Value };
+    }
+
+    [[nodiscard]] constexpr const T& operator*() const noexcept { return m_value; }
+
+    [[nodiscard]] constexpr const T* operator->() const noexcept { return &m_value; }
+
+    // Arithmetic operators ............................................................................................
+
+    [[nodiscard]] constexpr friend bounded operator+(const bounded rhs) noexcept { return rhs; }
+
+    [[nodiscard]] constexpr friend bounded operator-(const bounded rhs) noexcept(is_nothrow)
+    {
+        return bounded{ trusted_t{}, negate(rhs.m_value) };
+    }
+
+    [[nodiscard]] constexpr friend bounded operator+(const bounded lhs, const bounded rhs) noexcept(is_nothrow)
+    {
+        return bounded{ trusted_t{}, add(lhs.m_value, rhs.m_value) };
+    }
+
+    [[nodiscard]] constexpr friend bounded operator-(const bounded lhs, const bounded rhs) noexcept(is_nothrow)
+    {
+        return bounded{ trusted_t{}, subtract(lhs.m_value, rhs.m_value) };
+    }
+
+    [[nodiscard]] constexpr friend bounded operator*(const bounded lhs, const bounded rhs) noexcept(is_nothrow)
+    {
+        return bounded{ trusted_t{}, multiply(lhs.m_value, rhs.m_value) };
+    }
+
+    [[nodiscard]] constexpr friend bounded operator/(const bounded lhs, const bounded rhs) noexcept(is_nothrow)
+    {
+        return bounded{ trusted_t{}, divide(lhs.m_value, rhs.m_value) };
+    }
+
+    [[nodiscard]] constexpr friend bounded operator%(const bounded lhs, const bounded rhs) noexcept(is_nothrow)
+        requires std::integral<T>
+    {
+        return bounded{ trusted_t{}, remainder(lhs.m_value, rhs.m_value) };
+    }
+
+    // Assignment operators ............................................................................................
+
+    constexpr friend bounded& operator+=(bounded& lhs, const bounded rhs) noexcept(is_nothrow)
+    {
+        return lhs = lhs + rhs;
+    }
+
+    constexpr friend bounded& operator-=(bounded& lhs, const bounded rhs) noexcept(is_nothrow)
+    {
+        return lhs = lhs - rhs;
+    }
+
+    constexpr friend bounded& operator*=(bounded& lhs, const bounded rhs) noexcept(is_nothrow)
+    {
+        return lhs = lhs * rhs;
+    }
+
+    constexpr friend bounded& operator/=(bounded& lhs, const bounded rhs) noexcept(is_nothrow)
+    {
+        return lhs = lhs / rhs;
+    }
+
+    constexpr friend bounded& operator%=(bounded& lhs, const bounded rhs) noexcept(is_nothrow)
+        requires std::integral<T>
+    {
+        return lhs = lhs % rhs;
+    }
+
+    // Increment and decrement operators ...............................................................................
+
+    constexpr bounded& operator++() noexcept(is_nothrow)
+        requires std::integral<T>
+    {
+        m_value = add(m_value, T{ 1 });
+        return *this;
+    }
+
+    constexpr bounded& operator--() noexcept(is_nothrow)
+        requires std::integral<T>
+    {
+        m_value = subtract(m_value, T{ 1 });
+        return *this;
+    }
+
+    constexpr bounded operator++(int) noexcept(is_nothrow)
+        requires std::integral<T>
+    {
+        const bounded previous = *this;
+        ++*this;
+        return previous;
+    }
+
+    constexpr bounded operator--(int) noexcept(is_nothrow)
+        requires std::integral<T>
+    {
+        const bounded previous = *this;
+        --*this;
+        return previous;
+    }
+
+    // Comparison operators ............................................................................................
+
+    [[nodiscard]] constexpr friend bool operator==(const bounded lhs, const bounded rhs) noexcept = default;
+
+    [[nodiscard]] constexpr friend auto operator<=>(const bounded lhs, const bounded rhs) noexcept = default;
+
+private:
+
+    T m_value;
+};
+
+/// Strong type of an arithmetic value in [Min, Max]
+template <typename T, T Min, T Max, bound_policy Policy, std::size_t Tag, options... Options>
+using bounded_type = strong_type<bounded<T, Min, Max, Policy>, Tag, Options...>;
+
+template <typename T, T Min, T Max, bound_policy Policy>
+std::ostream& operator<<(std::ostream& os, const bounded<T, Min, Max, Policy> rhs)
+{
+    return os << *rhs;
+}
+
+namespace traits
+{
+
+template <typename T, T Min, T Max, bound_policy Policy>
+constexpr bool formats_as_value<bounded<T, Min, Max, Policy>> = true;
+
+}  // namespace traits
+
+}  // namespace stronger
+
+template <typename T, T Min, T Max, stronger::bound_policy Policy>
+struct std::hash<stronger::bounded<T, Min, Max, Policy>>
+{
+    constexpr hash() = default;
+    static constexpr auto operator()(const stronger::bounded<T, Min, Max, Policy> b) noexcept
+    {
+        return std::hash<T>{}(*b);
+    }
+};
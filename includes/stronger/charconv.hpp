@@ -0,0 +1,120 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+#include "strong_type.hpp"
+#include <charconv>
+#include <concepts>
+#include <expected>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace stronger
+{
+
+/**
+ * Customization point of stronger::to_chars() and stronger::from_chars(), for underlying types that <charconv> does not
+ * support. Specializations provide the following static functions, that behave like their <charconv> counterparts:
+ *
+ * @code
+ * static std::to_chars_result to_chars(char* first, char* last, const T& value, Args... args);
+ * static std::from_chars_result from_chars(const char* first, const char* last, T& value, Args... args);
+ * @endcode
+ *
+ * Extra arguments like the base or the std::chars_format are optional.
+ */
+template <typename T>
+struct char_conversion
+{
+};
+
+/// Integers and floating point numbers are converted by <charconv>
+template <typename T>
+    requires std::is_arithmetic_v<T> && (!std::same_as<T, bool>)
+struct char_conversion<T>
+{
+    template <typename... Args>
+    static constexpr std::to_chars_result to_chars(char* const first, char* const last, const T value,
+                                                   const Args... args) noexcept
+    {
+        return std::to_chars(first, last, value, args...);
+    }
+
+    template <typename... Args>
+    static constexpr std::from_chars_result from_chars(const char* const first, const char* const last, T& value,
+                                                       const Args... args) noexcept
+    {
+        return std::from_chars(first, last, value, args...);
+    }
+};
+
+namespace concepts
+{
+
+template <typename T, typename... Args>
+concept to_chars_convertible = requires(char* buffer, const T& value, Args... args) {
+    { char_conversion<T>::to_chars(buffer, buffer, value, args...) } -> std::same_as<std::to_chars_result>;
+};
+
+template <typename T, typename... Args>
+concept from_chars_convertible = requires(const char* buffer, T& value, Args... args) {
+    { char_conversion<T>::from_chars(buffer, buffer, value, args...) } -> std::same_as<std::from_chars_result>;
+};
+
+}  // namespace concepts
+
+/**
+ * Writes the underlying value of `value` to [first, last), like std::to_chars.
+ * Does not allocate and does not depend on the locale.
+ *
+ * @param args Extra arguments of std::to_chars, like the base of integers or the std::chars_format of floating points
+ */
+template <typename T, size_t Tag, options... Options, typename... Args>
+    requires concepts::to_chars_convertible<T, Args...>
+constexpr std::to_chars_result to_chars(char* const first, char* const last,
+                                        const strong_type<T, Tag, Options...>& value, const Args... args)
+    noexcept(noexcept(char_conversion<T>::to_chars(first, last, *value, args...)))
+{
+    return char_conversion<T>::to_chars(first, last, *value, args...);
+}
+
+/**
+ * Reads the underlying value of `value` from [first, last), like std::from_chars.
+ * `value` is left unchanged on error.
+ *
+ * @param args Extra arguments of std::from_chars, like the base of integers or the std::chars_format of floating points
+ */
+template <typename T, size_t Tag, options... Options, typename... Args>
+    requires concepts::from_chars_convertible<T, Args...>
+constexpr std::from_chars_result from_chars(const char* const first, const char* const last,
+                                            strong_type<T, Tag, Options...>& value, const Args... args)
+    noexcept(noexcept(char_conversion<T>::from_chars(first, last, *value, args...)))
+{
+    return char_conversion<T>::from_chars(first, last, *value, args...);
+}
+
+/**
+ * Parses a whole string as a strong type
+ *
+ * @return The parsed value, or std::errc::invalid_argument if `text` is not entirely a value,
+ *         or std::errc::result_out_of_range if the value does not fit in the underlying type
+ */
+template <typename S, typename... Args>
+    requires traits::is_strong_type<S> &&
+             concepts::from_chars_convertible<typename traits::strong_type_info<S>::underlying_type, Args...> &&
+             std::default_initializable<S>
+constexpr std::expected<S, std::errc> parse(const std::string_view text, const Args... args)
+{
+    S value{};
+    const char* const last = text.data() + text.size();
+    const auto [end, error] = from_chars(text.data(), last, value, args...);
+    if(error != std::errc{})
+        return std::unexpected(error);
+    if(end != last)
+        return std::unexpected(std::errc::invalid_argument);
+    return value;
+}
+
+}  // namespace stronger
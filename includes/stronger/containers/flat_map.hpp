@@ -0,0 +1,576 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+#include "strong_type.hpp"
+#include <algorithm>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace stronger
+{
+
+namespace concepts
+{
+
+/// Keys of flat_map and flat_set: strong types with a total order
+template <typename Key>
+concept flat_key = traits::is_strong_type<Key> && std::totally_ordered<Key> && std::copy_constructible<Key>;
+
+}  // namespace concepts
+
+namespace internal::flat
+{
+
+/// Hints the processor to load the cache line of `address`, that the next iteration of a search may read
+constexpr void prefetch([[maybe_unused]] const void* const address) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    if !consteval
+    {
+        __builtin_prefetch(address);
+    }
+#endif
+}
+
+/**
+ * How flat containers store and search their keys. Keys of arithmetic underlying types are stored unwrapped, so that
+ * searches run on a plain array of numbers, and are given back as strong types by value. bool is excluded: it would
+ * make a std::vector<bool>, which packs bits and has no data()
+ */
+template <concepts::flat_key Key>
+struct key_traits
+{
+    static constexpr bool unwrapped = std::is_arithmetic_v<typename Key::underlying_type> &&
+                                      !std::same_as<std::remove_cv_t<typename Key::underlying_type>, bool>;
+    using stored_type = std::conditional_t<unwrapped, typename Key::underlying_type, Key>;
+    using reference = std::conditional_t<unwrapped, Key, const Key&>;
+
+    /// Under this size, the search counts the smaller keys instead of halving the range: compilers vectorize it
+    static constexpr std::size_t linear_search_size = 64 / sizeof(stored_type) > 0 ? 64 / sizeof(stored_type) : 1;
+
+    [[nodiscard]] static constexpr const stored_type& unwrap(const Key& key) noexcept
+    {
+        if constexpr(unwrapped)
+            return *key;
+        else
+            return key;
+    }
+
+    [[nodiscard]] static constexpr reference wrap(const stored_type& stored) noexcept
+    {
+        if constexpr(unwrapped)
+            return Key{ stored };
+        else
+            return stored;
+    }
+
+    /// Position of the first key that is not less than `key`
+    [[nodiscard]] static constexpr std::size_t lower_bound(const std::vector<stored_type>& keys,
+                                                           const stored_type& key) noexcept
+    {
+        if constexpr(unwrapped)
+        {
+            // Halves the range without branching on the comparison, that compilers turn into a conditional move:
+            // lookups of random keys don't stall on mispredictions. Both keys the next iteration may compare to are
+            // prefetched, which hides the cache misses of large maps
+            const stored_type* base = keys.data();
+            std::size_t length = keys.size();
+            while(length > linear_search_size)
+            {
+                const std::size_t half = length / 2;
+                prefetch(base + half / 2);
+                prefetch(base + half + half / 2);
+                base += base[half] < key ? half : 0;
+                length -= half;
+            }
+            std::size_t position = internal::cast<std::size_t>(base - keys.data());
+            for(std::size_t i = 0; i < length; ++i)
+                position += std::size_t{ base[i] < key };
+            return position;
+        }
+        else
+        {
+            return internal::cast<std::size_t>(std::ranges::lower_bound(keys, key) - keys.begin());
+        }
+    }
+};
+
+/**
+ * Random access iterator over the elements of a flat container. It holds the container and a position:
+ * dereferencing it gives `owner->element(position)`.
+ */
+template <typename Owner, typename Value, typename Reference>
+class position_iterator
+{
+    friend std::remove_const_t<Owner>;
+    template <typename, typename, typename>
+    friend class position_iterator;
+
+    struct arrow_proxy
+    {
+        Reference reference;
+
+        [[nodiscard]] constexpr const std::remove_reference_t<Reference>* operator->() const noexcept
+        {
+            return &reference;
+        }
+    };
+
+    constexpr position_iterator(Owner* const owner, const std::size_t position) noexcept :
+            m_owner(owner),
+            m_position(position)
+    {
+    }
+
+public:
+
+    using value_type = Value;
+    using reference = Reference;
+    using difference_type = std::ptrdiff_t;
+    using iterator_concept = std::random_access_iterator_tag;
+    using iterator_category = std::input_iterator_tag;  // Dereferencing may give a pair of references, or a value
+
+    constexpr position_iterator() = default;
+
+    /// iterator converts to const_iterator
+    template <typename OtherOwner, typename OtherReference>
+        requires std::same_as<const OtherOwner, Owner> && (!std::same_as<OtherOwner, Owner>)
+    constexpr explicit(false)
+        position_iterator(const position_iterator<OtherOwner, Value, OtherReference>& other) noexcept :
+            m_owner(other.m_owner),
+            m_position(other.m_position)
+    {
+    }
+
+    [[nodiscard]] constexpr reference operator*() const noexcept { return m_owner->element(m_position); }
+
+    [[nodiscard]] constexpr arrow_proxy operator->() const noexcept { return { **this }; }
+
+    [[nodiscard]] constexpr reference operator[](const difference_type offset) const noexcept
+    {
+        return *(*this + offset);
+    }
+
+    constexpr position_iterator& operator++() noexcept
+    {
+        ++m_position;
+        return *this;
+    }
+
+    constexpr position_iterator operator++(int) noexcept
+    {
+        auto copy = *this;
+        ++*this;
+        return copy;
+    }
+
+    constexpr position_iterator& operator--() noexcept
+    {
+        --m_position;
+        return *this;
+    }
+
+    constexpr position_iterator operator--(int) noexcept
+    {
+        auto copy = *this;
+        --*this;
+        return copy;
+    }
+
+    constexpr position_iterator& operator+=(const difference_type offset) noexcept
+    {
+        m_position = static_cast<std::size_t>(static_cast<difference_type>(m_position) + offset);
+        return *this;
+    }
+
+    constexpr position_iterator& operator-=(const difference_type offset) noexcept { return *this += -offset; }
+
+    [[nodiscard]] constexpr friend position_iterator operator+(position_iterator it,
+                                                               const difference_type offset) noexcept
+    {
+        return it += offset;
+    }
+
+    [[nodiscard]] constexpr friend position_iterator operator+(const difference_type offset,
+                                                               position_iterator it) noexcept
+    {
+        return it += offset;
+    }
+
+    [[nodiscard]] constexpr friend position_iterator operator-(position_iterator it,
+                                                               const difference_type offset) noexcept
+    {
+        return it -= offset;
+    }
+
+    [[nodiscard]] constexpr friend difference_type operator-(const position_iterator& lhs,
+                                                             const position_iterator& rhs) noexcept
+    {
+        return static_cast<difference_type>(lhs.m_position) - static_cast<difference_type>(rhs.m_position);
+    }
+
+    [[nodiscard]] constexpr friend bool operator==(const position_iterator& lhs,
+                                                   const position_iterator& rhs) noexcept
+    {
+        return lhs.m_position == rhs.m_position;
+    }
+
+    [[nodiscard]] constexpr friend auto operator<=>(const position_iterator& lhs,
+                                                    const position_iterator& rhs) noexcept
+    {
+        return lhs.m_position <=> rhs.m_position;
+    }
+
+private:
+
+    Owner* m_owner = nullptr;
+    std::size_t m_position = 0;
+};
+
+}  // namespace internal::flat
+
+/**
+ * Sorted set of strong types, stored in a contiguous array. Keys of arithmetic underlying types are stored and
+ * searched as plain numbers: lookups are a branchless binary search over an array of integers or floating points.
+ *
+ * Inserting and erasing keys moves the next ones: build sets from many keys at once with the constructors, that sort
+ * them once.
+ *
+ * @tparam Key Strong type of the keys
+ */
+template <concepts::flat_key Key>
+class flat_set
+{
+    using traits = internal::flat::key_traits<Key>;
+    using stored_type = traits::stored_type;
+
+public:
+
+    using key_type = Key;
+    using value_type = Key;
+    using reference = traits::reference;
+    using const_reference = traits::reference;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = internal::flat::position_iterator<const flat_set, Key, reference>;
+    using const_iterator = iterator;
+
+    constexpr flat_set() = default;
+
+    /// Sorts `keys` and removes their duplicates
+    constexpr explicit flat_set(const std::vector<Key>& keys)
+    {
+        m_keys.reserve(keys.size());
+        for(const Key& key : keys)
+            m_keys.push_back(traits::unwrap(key));
+        std::ranges::sort(m_keys);
+        const auto [first, last] = std::ranges::unique(m_keys);
+        m_keys.erase(first, last);
+    }
+
+    constexpr flat_set(std::initializer_list<Key> keys) : flat_set(std::vector<Key>(keys)) {}
+
+    [[nodiscard]] constexpr iterator begin() const noexcept { return { this, 0 }; }
+
+    [[nodiscard]] constexpr iterator end() const noexcept { return { this, size() }; }
+
+    [[nodiscard]] constexpr size_type size() const noexcept { return m_keys.size(); }
+
+    [[nodiscard]] constexpr bool empty() const noexcept { return m_keys.empty(); }
+
+    constexpr void reserve(const size_type capacity) { m_keys.reserve(capacity); }
+
+    constexpr void clear() noexcept { m_keys.clear(); }
+
+    // Lookup ..........................................................................................................
+
+    [[nodiscard]] constexpr iterator lower_bound(const Key& key) const noexcept
+    {
+        return { this, traits::lower_bound(m_keys, traits::unwrap(key)) };
+    }
+
+    [[nodiscard]] constexpr iterator find(const Key& key) const noexcept
+    {
+        const size_type position = traits::lower_bound(m_keys, traits::unwrap(key));
+        return { this, is_at(position, key) ? position : size() };
+    }
+
+    [[nodiscard]] constexpr bool contains(const Key& key) const noexcept
+    {
+        return is_at(traits::lower_bound(m_keys, traits::unwrap(key)), key);
+    }
+
+    [[nodiscard]] constexpr size_type count(const Key& key) const noexcept { return contains(key) ? 1 : 0; }
+
+    // Modifiers .......................................................................................................
+
+    constexpr std::pair<iterator, bool> insert(const Key& key)
+    {
+        const size_type position = traits::lower_bound(m_keys, traits::unwrap(key));
+        if(is_at(position, key))
+            return { iterator{ this, position }, false };
+        m_keys.insert(m_keys.begin() + static_cast<difference_type>(position), traits::unwrap(key));
+        return { iterator{ this, position }, true };
+    }
+
+    constexpr iterator erase(const iterator position)
+    {
+        m_keys.erase(m_keys.begin() + static_cast<difference_type>(position.m_position));
+        return position;
+    }
+
+    constexpr size_type erase(const Key& key)
+    {
+        const size_type position = traits::lower_bound(m_keys, traits::unwrap(key));
+        if(!is_at(position, key))
+            return 0;
+        m_keys.erase(m_keys.begin() + static_cast<difference_type>(position));
+        return 1;
+    }
+
+    [[nodiscard]] constexpr friend bool operator==(const flat_set& lhs, const flat_set& rhs) = default;
+
+private:
+
+    friend iterator;
+
+    [[nodiscard]] constexpr reference element(const size_type position) const noexcept
+    {
+        return traits::wrap(m_keys[position]);
+    }
+
+    [[nodiscard]] constexpr bool is_at(const size_type position, const Key& key) const noexcept
+    {
+        return position < m_keys.size() && !(traits::unwrap(key) < m_keys[position]);
+    }
+
+    std::vector<stored_type> m_keys;
+};
+
+/**
+ * Sorted map from strong types to values, stored as two contiguous arrays: one of keys and one of values. Keys of
+ * arithmetic underlying types are stored and searched as plain numbers: lookups are a branchless binary search over an
+ * array of integers or floating points, and iterating over the map reads both arrays sequentially.
+ *
+ * Dereferencing an iterator gives a `std::pair` of the key, and of a reference to the value. Inserting and erasing
+ * elements moves the next ones: build maps from many elements at once with the constructors, that sort them once.
+ *
+ * @tparam Key Strong type of the keys
+ * @tparam T Type of the values
+ */
+template <concepts::flat_key Key, typename T>
+class flat_map
+{
+    using traits = internal::flat::key_traits<Key>;
+    using stored_type = traits::stored_type;
+
+public:
+
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<Key, T>;
+    using reference = std::pair<typename traits::reference, T&>;
+    using const_reference = std::pair<typename traits::reference, const T&>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = internal::flat::position_iterator<flat_map, value_type, reference>;
+    using const_iterator = internal::flat::position_iterator<const flat_map, value_type, const_reference>;
+
+    constexpr flat_map() = default;
+
+    /// Sorts `elements` by key. Only the first element of each key is kept
+    constexpr explicit flat_map(std::vector<value_type> elements)
+    {
+        std::ranges::stable_sort(elements, std::ranges::less{}, &value_type::first);
+        const auto [first, last] = std::ranges::unique(elements, std::ranges::equal_to{}, &value_type::first);
+        elements.erase(first, last);
+        m_keys.reserve(elements.size());
+        m_values.reserve(elements.size());
+        for(value_type& element : elements)
+        {
+            m_keys.push_back(traits::unwrap(element.first));
+            m_values.push_back(std::move(element.second));
+        }
+    }
+
+    constexpr flat_map(std::initializer_list<value_type> elements) : flat_map(std::vector<value_type>(elements)) {}
+
+    [[nodiscard]] constexpr iterator begin() noexcept { return { this, 0 }; }
+
+    [[nodiscard]] constexpr const_iterator begin() const noexcept { return { this, 0 }; }
+
+    [[nodiscard]] constexpr iterator end() noexcept { return { this, size() }; }
+
+    [[nodiscard]] constexpr const_iterator end() const noexcept { return { this, size() }; }
+
+    [[nodiscard]] constexpr size_type size() const noexcept { return m_keys.size(); }
+
+    [[nodiscard]] constexpr bool empty() const noexcept { return m_keys.empty(); }
+
+    constexpr void reserve(const size_type capacity)
+    {
+        m_keys.reserve(capacity);
+        m_values.reserve(capacity);
+    }
+
+    constexpr void clear() noexcept
+    {
+        m_keys.clear();
+        m_values.clear();
+    }
+
+    // Lookup ..........................................................................................................
+
+    [[nodiscard]] constexpr iterator lower_bound(const Key& key) noexcept
+    {
+        return { this, traits::lower_bound(m_keys, traits::unwrap(key)) };
+    }
+
+    [[nodiscard]] constexpr const_iterator lower_bound(const Key& key) const noexcept
+    {
+        return { this, traits::lower_bound(m_keys, traits::unwrap(key)) };
+    }
+
+    [[nodiscard]] constexpr iterator find(const Key& key) noexcept { return { this, find_position(key) }; }
+
+    [[nodiscard]] constexpr const_iterator find(const Key& key) const noexcept
+    {
+        return { this, find_position(key) };
+    }
+
+    [[nodiscard]] constexpr bool contains(const Key& key) const noexcept { return find_position(key) != size(); }
+
+    [[nodiscard]] constexpr size_type count(const Key& key) const noexcept { return contains(key) ? 1 : 0; }
+
+    /// @throws std::out_of_range If `key` is not in the map
+    [[nodiscard]] constexpr T& at(const Key& key) { return m_values[checked_position(key)]; }
+
+    /// @throws std::out_of_range If `key` is not in the map
+    [[nodiscard]] constexpr const T& at(const Key& key) const { return m_values[checked_position(key)]; }
+
+    /// Inserts a value-initialized value if `key` is not in the map
+    constexpr T& operator[](const Key& key)
+        requires std::default_initializable<T>
+    {
+        return try_emplace(key).first->second;
+    }
+
+    // Modifiers .......................................................................................................
+
+    /// Constructs the value from `args` only if `key` is not in the map
+    template <typename... Args>
+        requires std::constructible_from<T, Args&&...>
+    constexpr std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args)
+    {
+        const size_type position = traits::lower_bound(m_keys, traits::unwrap(key));
+        if(is_at(position, key))
+            return { iterator{ this, position }, false };
+        const auto offset = static_cast<difference_type>(position);
+        m_values.emplace(m_values.begin() + offset, std::forward<Args>(args)...);
+        try
+        {
+            m_keys.insert(m_keys.begin() + offset, traits::unwrap(key));
+        }
+        catch(...)
+        {
+            m_values.erase(m_values.begin() + offset);
+            throw;
+        }
+        return { iterator{ this, position }, true };
+    }
+
+    constexpr std::pair<iterator, bool> insert(const value_type& element)
+        requires std::copy_constructible<T>
+    {
+        return try_emplace(element.first, element.second);
+    }
+
+    constexpr std::pair<iterator, bool> insert(value_type&& element)
+    {
+        return try_emplace(element.first, std::move(element.second));
+    }
+
+    template <typename U>
+        requires std::assignable_from<T&, U&&> && std::constructible_from<T, U&&>
+    constexpr std::pair<iterator, bool> insert_or_assign(const Key& key, U&& value)
+    {
+        const size_type position = traits::lower_bound(m_keys, traits::unwrap(key));
+        if(is_at(position, key))
+        {
+            m_values[position] = std::forward<U>(value);
+            return { iterator{ this, position }, false };
+        }
+        return try_emplace(key, std::forward<U>(value));
+    }
+
+    constexpr iterator erase(const const_iterator position)
+    {
+        const auto offset = static_cast<difference_type>(position.m_position);
+        m_keys.erase(m_keys.begin() + offset);
+        m_values.erase(m_values.begin() + offset);
+        return { this, position.m_position };
+    }
+
+    constexpr size_type erase(const Key& key)
+    {
+        const size_type position = find_position(key);
+        if(position == size())
+            return 0;
+        erase(const_iterator{ this, position });
+        return 1;
+    }
+
+    [[nodiscard]] constexpr friend bool operator==(const flat_map& lhs, const flat_map& rhs)
+        requires std::equality_comparable<T>
+    {
+        return lhs.m_keys == rhs.m_keys && lhs.m_values == rhs.m_values;
+    }
+
+private:
+
+    friend iterator;
+    friend const_iterator;
+
+    [[nodiscard]] constexpr reference element(const size_type position) noexcept
+    {
+        return { traits::wrap(m_keys[position]), m_values[position] };
+    }
+
+    [[nodiscard]] constexpr const_reference element(const size_type position) const noexcept
+    {
+        return { traits::wrap(m_keys[position]), m_values[position] };
+    }
+
+    [[nodiscard]] constexpr bool is_at(const size_type position, const Key& key) const noexcept
+    {
+        return position < m_keys.size() && !(traits::unwrap(key) < m_keys[position]);
+    }
+
+    [[nodiscard]] constexpr size_type find_position(const Key& key) const noexcept
+    {
+        const size_type position = traits::lower_bound(m_keys, traits::unwrap(key));
+        return is_at(position, key) ? position : size();
+    }
+
+    [[nodiscard]] constexpr size_type checked_position(const Key& key) const
+    {
+        const size_type position = find_position(key);
+        if(position == size())
+            throw std::out_of_range("stronger: key not found in flat_map");
+        return position;
+    }
+
+    std::vector<stored_type> m_keys;
+    std::vector<T> m_values;
+};
+
+}  // namespace stronger
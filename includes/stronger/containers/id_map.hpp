@@ -0,0 +1,595 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+#include "strong_type.hpp"
+#include "stronger/relocation.hpp"
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace stronger
+{
+
+namespace concepts
+{
+
+/// Keys of id_map: strong types of integers of at most 64 bits
+template <typename Key>
+concept id_key = traits::is_strong_type<Key> && std::integral<typename Key::underlying_type> &&
+                 (!std::same_as<typename Key::underlying_type, bool>) &&
+                 sizeof(typename Key::underlying_type) <= sizeof(uint64_t);
+
+}  // namespace concepts
+
+namespace internal::swiss
+{
+
+/// Control bytes of the slots: full slots hold 7 bits of the hash of their key, the others have their high bit set
+constexpr uint8_t empty = 0x80;
+constexpr uint8_t deleted = 0xfe;
+
+constexpr std::size_t group_size = sizeof(uint64_t);
+constexpr uint64_t low_bits = 0x0101010101010101ULL;
+constexpr uint64_t high_bits = 0x8080808080808080ULL;
+
+/**
+ * Control bytes of 8 consecutive slots, read as one word. Matches are masks with the high bit of the matching bytes
+ * set: each probe compares 8 slots at once, without branches nor SIMD instructions.
+ */
+class group
+{
+public:
+
+    explicit group(const uint8_t* const control) noexcept
+    {
+        std::memcpy(&m_word, control, sizeof(m_word));
+        if constexpr(std::endian::native == std::endian::big)
+            m_word = std::byteswap(m_word);
+    }
+
+    /// Slots whose control byte is `hash`. May report a few more slots, whose keys are compared anyway
+    [[nodiscard]] uint64_t match(const uint8_t hash) const noexcept
+    {
+        const uint64_t difference = m_word ^ (low_bits * hash);
+        return (difference - low_bits) & ~difference & high_bits;
+    }
+
+    /// Slots whose control byte is empty: bit 7 set and bit 1 clear
+    [[nodiscard]] uint64_t match_empty() const noexcept { return m_word & ~(m_word << 6) & high_bits; }
+
+    /// Slots whose control byte is empty or deleted: bit 7 set and bit 0 clear
+    [[nodiscard]] uint64_t match_free() const noexcept { return m_word & ~(m_word << 7) & high_bits; }
+
+private:
+
+    uint64_t m_word = 0;
+};
+
+/// Position in its group of the first slot of a match
+[[nodiscard]] inline std::size_t first(const uint64_t match) noexcept
+{
+    return internal::cast<std::size_t>(std::countr_zero(match)) / 8;
+}
+
+}  // namespace internal::swiss
+
+/**
+ * Hash map from strong types of integers, such as entity identifiers, to values. It is an open-addressing table of
+ * groups of 8 slots: each group stores the control bytes of its slots next to their keys and values, so that a lookup
+ * reads its control bytes and the matching slot from neighbouring cache lines.
+ *
+ * Keys are mixed with a multiplication by 2^64 / φ (Fibonacci hashing), so that sequential identifiers spread over
+ * the whole table, unlike with std::hash that is the identity for integers. Inserting allocates only when the table
+ * grows. Growing and erasing invalidate iterators and references, like in std::vector.
+ *
+ * Dereferencing an iterator gives a `std::pair` of the key, and of a reference to the value.
+ *
+ * @tparam Key Strong type of integral underlying type
+ * @tparam T Type of the values. Its move constructor must not throw, since growing moves the values
+ */
+template <concepts::id_key Key, typename T>
+    requires std::is_nothrow_move_constructible_v<T> && std::is_nothrow_destructible_v<T>
+class id_map
+{
+    using underlying_type = Key::underlying_type;
+
+    struct slot
+    {
+        template <typename... Args>
+        explicit slot(const underlying_type k, Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args&&...>) :
+                key(k),
+                value(std::forward<Args>(args)...)
+        {
+        }
+
+        underlying_type key;
+        T value;
+    };
+
+    /// Control bytes of a group, followed by its slots, that are only constructed in full slots
+    struct block
+    {
+        uint8_t control[internal::swiss::group_size];
+        alignas(slot) std::byte storage[internal::swiss::group_size * sizeof(slot)];
+    };
+
+    template <bool IsConst>
+    class basic_iterator;
+
+public:
+
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<Key, T>;
+    using reference = std::pair<Key, T&>;
+    using const_reference = std::pair<Key, const T&>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    id_map() noexcept = default;
+
+    id_map(const id_map& other)
+        requires std::copy_constructible<T>
+    {
+        reserve(other.size());
+        try
+        {
+            for(const auto [key, value] : other)
+                try_emplace(key, value);
+        }
+        catch(...)
+        {
+            release();
+            throw;
+        }
+    }
+
+    id_map(id_map&& other) noexcept :
+            m_blocks(std::exchange(other.m_blocks, nullptr)),
+            m_capacity(std::exchange(other.m_capacity, 0)),
+            m_size(std::exchange(other.m_size, 0)),
+            m_deleted(std::exchange(other.m_deleted, 0)),
+            m_shift(std::exchange(other.m_shift, 0))
+    {
+    }
+
+    id_map& operator=(const id_map& other)
+        requires std::copy_constructible<T>
+    {
+        if(this != &other)
+            *this = id_map(other);
+        return *this;
+    }
+
+    id_map& operator=(id_map&& other) noexcept
+    {
+        if(this != &other)
+        {
+            release();
+            m_blocks = std::exchange(other.m_blocks, nullptr);
+            m_capacity = std::exchange(other.m_capacity, 0);
+            m_size = std::exchange(other.m_size, 0);
+            m_deleted = std::exchange(other.m_deleted, 0);
+            m_shift = std::exchange(other.m_shift, 0);
+        }
+        return *this;
+    }
+
+    ~id_map() { release(); }
+
+    [[nodiscard]] iterator begin() noexcept { return { this, next_full(0) }; }
+
+    [[nodiscard]] const_iterator begin() const noexcept { return { this, next_full(0) }; }
+
+    [[nodiscard]] iterator end() noexcept { return { this, m_capacity }; }
+
+    [[nodiscard]] const_iterator end() const noexcept { return { this, m_capacity }; }
+
+    // Size and capacity ...............................................................................................
+
+    [[nodiscard]] size_type size() const noexcept { return m_size; }
+
+    [[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+
+    /// Number of elements the map can hold without growing
+    [[nodiscard]] size_type capacity() const noexcept { return max_load(m_capacity); }
+
+    void reserve(const size_type count)
+    {
+        size_type capacity = min_capacity;
+        while(max_load(capacity) < count)
+            capacity *= 2;
+        if(capacity > m_capacity)
+            rehash(capacity);
+    }
+
+    void clear() noexcept
+    {
+        destroy_slots();
+        for(size_type group = 0; group < m_capacity / internal::swiss::group_size; ++group)
+            std::fill_n(m_blocks[group].control, internal::swiss::group_size, internal::swiss::empty);
+        m_size = 0;
+        m_deleted = 0;
+    }
+
+    // Lookup ..........................................................................................................
+
+    [[nodiscard]] iterator find(const Key& key) noexcept { return { this, find_position(*key) }; }
+
+    [[nodiscard]] const_iterator find(const Key& key) const noexcept { return { this, find_position(*key) }; }
+
+    [[nodiscard]] bool contains(const Key& key) const noexcept { return find_position(*key) != m_capacity; }
+
+    [[nodiscard]] size_type count(const Key& key) const noexcept { return contains(key) ? 1 : 0; }
+
+    /// @throws std::out_of_range If `key` is not in the map
+    [[nodiscard]] T& at(const Key& key) { return slot_at(checked_position(key)).value; }
+
+    /// @throws std::out_of_range If `key` is not in the map
+    [[nodiscard]] const T& at(const Key& key) const { return slot_at(checked_position(key)).value; }
+
+    /// Inserts a value-initialized value if `key` is not in the map
+    T& operator[](const Key& key)
+        requires std::default_initializable<T>
+    {
+        return try_emplace(key).first->second;
+    }
+
+    // Modifiers .......................................................................................................
+
+    /// Constructs the value from `args` only if `key` is not in the map
+    template <typename... Args>
+        requires std::constructible_from<T, Args&&...>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args)
+    {
+        if(const size_type position = find_position(*key); position != m_capacity)
+            return { iterator{ this, position }, false };
+        if(m_size + m_deleted + 1 > max_load(m_capacity))
+        {
+            // `args` may refer to values of the map, that growing moves
+            T value(std::forward<Args>(args)...);
+            rehash(m_size + 1 > max_load(m_capacity) / 2 ? std::max(2 * m_capacity, min_capacity) : m_capacity);
+            return { iterator{ this, emplace_new(*key, std::move(value)) }, true };
+        }
+        return { iterator{ this, emplace_new(*key, std::forward<Args>(args)...) }, true };
+    }
+
+    std::pair<iterator, bool> insert(const value_type& element)
+        requires std::copy_constructible<T>
+    {
+        return try_emplace(element.first, element.second);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& element)
+    {
+        return try_emplace(element.first, std::move(element.second));
+    }
+
+    template <typename U>
+        requires std::assignable_from<T&, U&&> && std::constructible_from<T, U&&>
+    std::pair<iterator, bool> insert_or_assign(const Key& key, U&& value)
+    {
+        if(const size_type position = find_position(*key); position != m_capacity)
+        {
+            slot_at(position).value = std::forward<U>(value);
+            return { iterator{ this, position }, false };
+        }
+        return try_emplace(key, std::forward<U>(value));
+    }
+
+    /// @return Iterator to the next element
+    iterator erase(const const_iterator position) noexcept
+    {
+        erase_at(position.m_position);
+        return { this, next_full(position.m_position) };
+    }
+
+    size_type erase(const Key& key) noexcept
+    {
+        const size_type position = find_position(*key);
+        if(position == m_capacity)
+            return 0;
+        erase_at(position);
+        return 1;
+    }
+
+    [[nodiscard]] friend bool operator==(const id_map& lhs, const id_map& rhs)
+        requires std::equality_comparable<T>
+    {
+        if(lhs.size() != rhs.size())
+            return false;
+        for(const auto [key, value] : lhs)
+        {
+            const size_type position = rhs.find_position(*key);
+            if(position == rhs.m_capacity || !(rhs.slot_at(position).value == value))
+                return false;
+        }
+        return true;
+    }
+
+private:
+
+    static constexpr size_type min_capacity = 2 * internal::swiss::group_size;
+
+    /// The table grows past 7/8 of full or deleted slots, so that probes find an empty slot quickly
+    [[nodiscard]] static constexpr size_type max_load(const size_type capacity) noexcept
+    {
+        return capacity - capacity / 8;
+    }
+
+    [[nodiscard]] static constexpr uint64_t mix(const underlying_type key) noexcept
+    {
+        const auto bits = internal::cast<std::make_unsigned_t<underlying_type>>(key);
+        return internal::cast<uint64_t>(bits) * 0x9e3779b97f4a7c15ULL;
+    }
+
+    /// The 7 bits below the ones that select the group. The low bits of the product only depend on the low bits of
+    /// the key: keys 128 apart would all get the same control byte
+    [[nodiscard]] uint8_t control_byte(const uint64_t hash) const noexcept
+    {
+        return static_cast<uint8_t>((hash >> (m_shift - 7)) & 0x7f);
+    }
+
+    [[nodiscard]] size_type first_group(const uint64_t hash) const noexcept
+    {
+        return internal::cast<size_type>(hash >> m_shift);
+    }
+
+    [[nodiscard]] size_type next_group(const size_type group) const noexcept
+    {
+        return (group + 1) & (group_count() - 1);
+    }
+
+    [[nodiscard]] size_type group_count() const noexcept { return m_capacity / internal::swiss::group_size; }
+
+    [[nodiscard]] uint8_t& control_at(const size_type position) const noexcept
+    {
+        return m_blocks[position / internal::swiss::group_size].control[position % internal::swiss::group_size];
+    }
+
+    /// Slot of a position, that must be full to be read
+    [[nodiscard]] slot& slot_at(const size_type position) const noexcept
+    {
+        return slot_in(m_blocks[position / internal::swiss::group_size], position % internal::swiss::group_size);
+    }
+
+    [[nodiscard]] static slot& slot_in(block& group, const size_type index) noexcept
+    {
+        return std::launder(reinterpret_cast<slot*>(group.storage))[index];
+    }
+
+    /// Position of `key`, or m_capacity if it is not in the map.
+    /// Probing stops at the first group with an empty slot: keys are never stored after such a group
+    [[nodiscard]] size_type find_position(const underlying_type key) const noexcept
+    {
+        if(m_capacity == 0)
+            return m_capacity;
+        const uint64_t hash = mix(key);
+        const uint8_t control = control_byte(hash);
+        for(size_type group = first_group(hash);; group = next_group(group))
+        {
+            block& candidates = m_blocks[group];
+            const internal::swiss::group controls(candidates.control);
+            for(uint64_t match = controls.match(control); match != 0; match &= match - 1)
+            {
+                const size_type index = internal::swiss::first(match);
+                if(candidates.control[index] == control && slot_in(candidates, index).key == key)
+                    return group * internal::swiss::group_size + index;
+            }
+            if(controls.match_empty() != 0)
+                return m_capacity;
+        }
+    }
+
+    /// First empty or deleted slot of the groups probed for `hash`
+    [[nodiscard]] size_type free_position(const uint64_t hash) const noexcept
+    {
+        for(size_type group = first_group(hash);; group = next_group(group))
+        {
+            if(const uint64_t match = internal::swiss::group(m_blocks[group].control).match_free(); match != 0)
+                return group * internal::swiss::group_size + internal::swiss::first(match);
+        }
+    }
+
+    /// Constructs a new element in the first free slot for `key`, that is not in the map
+    template <typename... Args>
+    size_type emplace_new(const underlying_type key, Args&&... args)
+    {
+        const uint64_t hash = mix(key);
+        const size_type position = free_position(hash);
+        std::construct_at(&slot_at(position), key, std::forward<Args>(args)...);
+        if(control_at(position) == internal::swiss::deleted)
+            --m_deleted;
+        control_at(position) = control_byte(hash);
+        ++m_size;
+        return position;
+    }
+
+    [[nodiscard]] size_type checked_position(const Key& key) const
+    {
+        const size_type position = find_position(*key);
+        if(position == m_capacity)
+            throw std::out_of_range("stronger: key not found in id_map");
+        return position;
+    }
+
+    [[nodiscard]] bool is_full(const size_type position) const noexcept
+    {
+        return (control_at(position) & internal::swiss::empty) == 0;
+    }
+
+    [[nodiscard]] size_type next_full(size_type position) const noexcept
+    {
+        while(position < m_capacity && !is_full(position))
+            ++position;
+        return position;
+    }
+
+    /// A slot of a group that has an empty slot becomes empty: no key was stored after this group
+    void erase_at(const size_type position) noexcept
+    {
+        std::destroy_at(&slot_at(position));
+        if(internal::swiss::group(m_blocks[position / internal::swiss::group_size].control).match_empty() != 0)
+        {
+            control_at(position) = internal::swiss::empty;
+        }
+        else
+        {
+            control_at(position) = internal::swiss::deleted;
+            ++m_deleted;
+        }
+        --m_size;
+    }
+
+    /// Moves the elements to a table of `capacity` slots, which drops the deleted slots
+    void rehash(const size_type capacity)
+    {
+        const size_type groups = capacity / internal::swiss::group_size;
+        block* const blocks = std::allocator<block>{}.allocate(groups);
+        for(size_type group = 0; group < groups; ++group)
+            std::fill_n(blocks[group].control, internal::swiss::group_size, internal::swiss::empty);
+
+        block* const previousBlocks = std::exchange(m_blocks, blocks);
+        const size_type previousGroups = group_count();
+        m_capacity = capacity;
+        m_shift = 64 - std::countr_zero(groups);
+        m_deleted = 0;
+        for(size_type group = 0; group < previousGroups; ++group)
+        {
+            for(size_type index = 0; index < internal::swiss::group_size; ++index)
+            {
+                const uint8_t control = previousBlocks[group].control[index];
+                if((control & internal::swiss::empty) != 0)
+                    continue;
+                slot& previous = slot_in(previousBlocks[group], index);
+                const uint64_t hash = mix(previous.key);
+                const size_type position = free_position(hash);
+                if constexpr(is_trivially_relocatable_v<T>)
+                {
+                    std::memcpy(static_cast<void*>(&slot_at(position)), static_cast<const void*>(&previous),
+                                sizeof(slot));
+                }
+                else
+                {
+                    std::construct_at(&slot_at(position), previous.key, std::move(previous.value));
+                    std::destroy_at(&previous);
+                }
+                control_at(position) = control_byte(hash);
+            }
+        }
+        if(previousBlocks != nullptr)
+            std::allocator<block>{}.deallocate(previousBlocks, previousGroups);
+    }
+
+    void destroy_slots() noexcept
+    {
+        if constexpr(!std::is_trivially_destructible_v<T>)
+        {
+            for(size_type i = 0; i < m_capacity; ++i)
+                if(is_full(i))
+                    std::destroy_at(&slot_at(i));
+        }
+    }
+
+    void release() noexcept
+    {
+        if(m_blocks != nullptr)
+        {
+            destroy_slots();
+            std::allocator<block>{}.deallocate(m_blocks, group_count());
+        }
+    }
+
+    block* m_blocks = nullptr;
+    size_type m_capacity = 0;
+    size_type m_size = 0;
+    size_type m_deleted = 0;
+    int m_shift = 0;
+
+    /// Forward iterator over the full slots. It holds the map and the position of a slot
+    template <bool IsConst>
+    class basic_iterator
+    {
+        using owner = std::conditional_t<IsConst, const id_map, id_map>;
+        friend id_map;
+
+        struct arrow_proxy
+        {
+            std::conditional_t<IsConst, id_map::const_reference, id_map::reference> element;
+
+            [[nodiscard]] const auto* operator->() const noexcept { return &element; }
+        };
+
+        basic_iterator(owner* const map, const size_type position) noexcept :
+                m_map(map),
+                m_position(position)
+        {
+        }
+
+    public:
+
+        using value_type = id_map::value_type;
+        using reference = std::conditional_t<IsConst, id_map::const_reference, id_map::reference>;
+        using difference_type = id_map::difference_type;
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::input_iterator_tag;  // Dereferencing gives a pair with a reference
+
+        basic_iterator() = default;
+
+        /// iterator converts to const_iterator
+        template <bool OtherIsConst>
+            requires IsConst && (!OtherIsConst)
+        explicit(false) basic_iterator(const basic_iterator<OtherIsConst>& other) noexcept :
+                m_map(other.m_map),
+                m_position(other.m_position)
+        {
+        }
+
+        [[nodiscard]] reference operator*() const noexcept
+        {
+            auto& element = m_map->slot_at(m_position);
+            return { Key{ element.key }, element.value };
+        }
+
+        [[nodiscard]] arrow_proxy operator->() const noexcept { return { **this }; }
+
+        basic_iterator& operator++() noexcept
+        {
+            m_position = m_map->next_full(m_position + 1);
+            return *this;
+        }
+
+        basic_iterator operator++(int) noexcept
+        {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        [[nodiscard]] friend bool operator==(const basic_iterator& lhs, const basic_iterator& rhs) noexcept
+        {
+            return lhs.m_position == rhs.m_position;
+        }
+
+    private:
+
+        friend class basic_iterator<true>;
+
+        owner* m_map = nullptr;
+        size_type m_position = 0;
+    };
+};
+
+}  // namespace stronger
@@ -0,0 +1,164 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+#include "strong_type.hpp"
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace stronger
+{
+
+namespace concepts
+{
+
+/// Strong types that can index strong containers
+template <typename Index>
+concept strong_index = traits::is_strong_type<Index> && std::integral<typename Index::underlying_type>;
+
+}  // namespace concepts
+
+namespace internal
+{
+
+/**
+ * Iterator over a strong container, yielding (index, value) pairs
+ *
+ * @tparam Index Index type of the container
+ * @tparam Iterator Iterator of the underlying storage
+ */
+template <typename Index, typename Iterator>
+class indexed_iterator
+{
+    using index_underlying_type = Index::underlying_type;
+
+public:
+
+    using value_type = std::pair<Index, std::iter_value_t<Iterator>>;
+    using reference = std::pair<Index, std::iter_reference_t<Iterator>>;
+    using difference_type = std::iter_difference_t<Iterator>;
+    using iterator_concept = std::forward_iterator_tag;
+
+    constexpr indexed_iterator() = default;
+
+    constexpr indexed_iterator(Iterator iterator, const index_underlying_type index) :
+            m_iterator(std::move(iterator)),
+            m_index(index)
+    {
+    }
+
+    [[nodiscard]] constexpr reference operator*() const { return { Index{ m_index }, *m_iterator }; }
+
+    constexpr indexed_iterator& operator++()
+    {
+        ++m_iterator;
+        ++m_index;
+        return *this;
+    }
+
+    constexpr indexed_iterator operator++(int)
+    {
+        auto copy = *this;
+        ++*this;
+        return copy;
+    }
+
+    [[nodiscard]] constexpr friend bool operator==(const indexed_iterator& lhs, const indexed_iterator& rhs)
+    {
+        return lhs.m_iterator == rhs.m_iterator;
+    }
+
+private:
+
+    Iterator m_iterator{};
+    index_underlying_type m_index{};
+};
+
+/**
+ * Common part of strong containers: storage that can only be subscripted by a strong index type
+ *
+ * @tparam Storage Underlying container
+ * @tparam Index Strong type used to index the container
+ * @tparam Options options to enable. Only options::bounds_checked has an effect
+ */
+template <typename Storage, concepts::strong_index Index, options... Options>
+class indexed_container
+{
+    using index_underlying_type = Index::underlying_type;
+    constexpr static bool bounds_checked = ((Options == options::bounds_checked) || ...);
+
+public:
+
+    using index_type = Index;
+    using storage_type = Storage;
+    using value_type = Storage::value_type;
+
+    [[nodiscard]] constexpr decltype(auto) operator[](this auto&& self, const Index index)
+    {
+        const std::size_t position = to_position(index);
+        if constexpr(bounds_checked)
+        {
+            if(position >= std::size(self.m_data))
+                throw std::out_of_range("stronger: index out of range");
+        }
+        return self.m_data[position];
+    }
+
+    [[nodiscard]] constexpr Index size() const noexcept { return to_index(std::size(m_data)); }
+
+    [[nodiscard]] constexpr bool empty() const noexcept { return std::empty(m_data); }
+
+    [[nodiscard]] constexpr auto begin(this auto&& self)
+    {
+        using iterator = decltype(std::begin(self.m_data));
+        return indexed_iterator<Index, iterator>{ std::begin(self.m_data), index_underlying_type{} };
+    }
+
+    [[nodiscard]] constexpr auto end(this auto&& self)
+    {
+        using iterator = decltype(std::end(self.m_data));
+        return indexed_iterator<Index, iterator>{ std::end(self.m_data), *self.size() };
+    }
+
+    [[nodiscard]] constexpr auto data(this auto&& self) noexcept { return std::data(self.m_data); }
+
+    /// Gives access to the underlying container, e.g. to run algorithms on the values only
+    [[nodiscard]] constexpr decltype(auto) operator*(this auto&& self) noexcept
+    {
+        return std::forward_like<decltype(self)>(self.m_data);
+    }
+
+    [[nodiscard]] constexpr auto operator->(this auto&& self) noexcept { return std::addressof(self.m_data); }
+
+protected:
+
+    constexpr indexed_container() = default;
+
+    constexpr explicit indexed_container(Storage data) : m_data(std::move(data)) {}
+
+    [[nodiscard]] static constexpr std::size_t to_position(const Index index) noexcept
+    {
+        if constexpr(std::same_as<index_underlying_type, std::size_t>)
+            return *index;
+        else
+            return static_cast<std::size_t>(*index);
+    }
+
+    [[nodiscard]] static constexpr Index to_index(const std::size_t position) noexcept
+    {
+        if constexpr(std::same_as<index_underlying_type, std::size_t>)
+            return Index{ position };
+        else
+            return Index{ static_cast<index_underlying_type>(position) };
+    }
+
+    Storage m_data{};
+};
+
+}  // namespace internal
+
+}  // namespace stronger
@@ -0,0 +1,292 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+#include "stronger/relocation.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace stronger
+{
+
+/**
+ * Vector that moves its elements with std::memcpy when they are trivially relocatable, according to
+ * stronger::is_trivially_relocatable. Growing and erasing elements then copies bytes, instead of moving and destroying
+ * the elements one by one, as std::vector does for strong types of std::unique_ptr for instance.
+ * Other elements are moved, or copied if their move constructor can throw, like in std::vector.
+ *
+ * @tparam T Type of the elements
+ */
+template <typename T>
+    requires std::is_object_v<T> && std::is_nothrow_destructible_v<T> &&
+             (std::is_move_constructible_v<T> || std::is_copy_constructible_v<T>)
+class relocating_vector
+{
+public:
+
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    relocating_vector() noexcept = default;
+
+    relocating_vector(std::initializer_list<T> values)
+        requires std::is_copy_constructible_v<T>
+    {
+        reserve(values.size());
+        try
+        {
+            for(const T& value : values)
+                push_back(value);
+        }
+        catch(...)
+        {
+            release();
+            throw;
+        }
+    }
+
+    relocating_vector(const relocating_vector& other)
+        requires std::is_copy_constructible_v<T>
+    {
+        reserve(other.size());
+        try
+        {
+            std::uninitialized_copy(other.begin(), other.end(), m_data);
+        }
+        catch(...)
+        {
+            release();
+            throw;
+        }
+        m_size = other.size();
+    }
+
+    relocating_vector(relocating_vector&& other) noexcept :
+            m_data(std::exchange(other.m_data, nullptr)),
+            m_size(std::exchange(other.m_size, 0)),
+            m_capacity(std::exchange(other.m_capacity, 0))
+    {
+    }
+
+    relocating_vector& operator=(const relocating_vector& other)
+        requires std::is_copy_constructible_v<T>
+    {
+        if(this != &other)
+            *this = relocating_vector(other);
+        return *this;
+    }
+
+    relocating_vector& operator=(relocating_vector&& other) noexcept
+    {
+        if(this != &other)
+        {
+            release();
+            m_data = std::exchange(other.m_data, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+            m_capacity = std::exchange(other.m_capacity, 0);
+        }
+        return *this;
+    }
+
+    ~relocating_vector() { release(); }
+
+    // Elements ........................................................................................................
+
+    [[nodiscard]] T& operator[](const size_type position) noexcept { return m_data[position]; }
+
+    [[nodiscard]] const T& operator[](const size_type position) const noexcept { return m_data[position]; }
+
+    [[nodiscard]] T& front() noexcept { return m_data[0]; }
+
+    [[nodiscard]] const T& front() const noexcept { return m_data[0]; }
+
+    [[nodiscard]] T& back() noexcept { return m_data[m_size - 1]; }
+
+    [[nodiscard]] const T& back() const noexcept { return m_data[m_size - 1]; }
+
+    [[nodiscard]] T* data() noexcept { return m_data; }
+
+    [[nodiscard]] const T* data() const noexcept { return m_data; }
+
+    [[nodiscard]] iterator begin() noexcept { return m_data; }
+
+    [[nodiscard]] const_iterator begin() const noexcept { return m_data; }
+
+    [[nodiscard]] iterator end() noexcept { return m_data + m_size; }
+
+    [[nodiscard]] const_iterator end() const noexcept { return m_data + m_size; }
+
+    // Size and capacity ...............................................................................................
+
+    [[nodiscard]] size_type size() const noexcept { return m_size; }
+
+    [[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+
+    [[nodiscard]] size_type capacity() const noexcept { return m_capacity; }
+
+    void reserve(const size_type capacity)
+    {
+        if(capacity > m_capacity)
+        {
+            T* const data = allocate(capacity);
+            try
+            {
+                relocate_to(data);
+            }
+            catch(...)
+            {
+                deallocate(data, capacity);
+                throw;
+            }
+            m_data = data;
+            m_capacity = capacity;
+        }
+    }
+
+    // Modifiers .......................................................................................................
+
+    /// Constructs the new element before moving the others, so that `args` can refer to elements of the vector
+    template <typename... Args>
+        requires std::constructible_from<T, Args&&...>
+    T& emplace_back(Args&&... args)
+    {
+        if(m_size < m_capacity)
+        {
+            T& element = *std::construct_at(m_data + m_size, std::forward<Args>(args)...);
+            ++m_size;
+            return element;
+        }
+
+        const size_type capacity = std::max<size_type>(2 * m_capacity, 8);
+        T* const data = allocate(capacity);
+        try
+        {
+            std::construct_at(data + m_size, std::forward<Args>(args)...);
+        }
+        catch(...)
+        {
+            deallocate(data, capacity);
+            throw;
+        }
+        try
+        {
+            relocate_to(data);
+        }
+        catch(...)
+        {
+            std::destroy_at(data + m_size);
+            deallocate(data, capacity);
+            throw;
+        }
+        m_data = data;
+        m_capacity = capacity;
+        return m_data[m_size++];
+    }
+
+    void push_back(const T& value)
+        requires std::is_copy_constructible_v<T>
+    {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    void pop_back() noexcept { std::destroy_at(m_data + --m_size); }
+
+    /// Removes the elements of [first, last), and moves the next ones back
+    iterator erase(const const_iterator first, const const_iterator last) noexcept(is_trivially_relocatable_v<T> ||
+                                                                                  std::is_nothrow_move_assignable_v<T>)
+    {
+        T* const begin = m_data + (first - m_data);
+        const size_type count = static_cast<size_type>(last - first);
+        if(count == 0)
+            return begin;
+        if constexpr(is_trivially_relocatable_v<T>)
+        {
+            std::destroy(begin, begin + count);
+            std::memmove(static_cast<void*>(begin), static_cast<const void*>(begin + count),
+                         static_cast<size_type>(end() - (begin + count)) * sizeof(T));
+        }
+        else
+        {
+            std::destroy(std::move(begin + count, end(), begin), end());
+        }
+        m_size -= count;
+        return begin;
+    }
+
+    iterator erase(const const_iterator position) noexcept(noexcept(erase(position, position + 1)))
+    {
+        return erase(position, position + 1);
+    }
+
+    void clear() noexcept
+    {
+        std::destroy(begin(), end());
+        m_size = 0;
+    }
+
+    [[nodiscard]] friend bool operator==(const relocating_vector& lhs, const relocating_vector& rhs)
+        requires std::equality_comparable<T>
+    {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+private:
+
+    [[nodiscard]] static T* allocate(const size_type capacity) { return std::allocator<T>{}.allocate(capacity); }
+
+    static void deallocate(T* const data, const size_type capacity) noexcept
+    {
+        std::allocator<T>{}.deallocate(data, capacity);
+    }
+
+    /// Moves the elements to `data`, that can hold them, and frees the previous storage.
+    /// If moving an element throws, the vector is left unchanged and `data` holds no element.
+    void relocate_to(T* const data)
+    {
+        if constexpr(is_trivially_relocatable_v<T>)
+        {
+            if(m_size > 0)
+                std::memcpy(static_cast<void*>(data), static_cast<const void*>(m_data), m_size * sizeof(T));
+        }
+        else
+        {
+            if constexpr(std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)
+                std::uninitialized_move(begin(), end(), data);
+            else
+                std::uninitialized_copy(begin(), end(), data);
+            std::destroy(begin(), end());
+        }
+        if(m_data != nullptr)
+            deallocate(m_data, m_capacity);
+    }
+
+    void release() noexcept
+    {
+        if(m_data != nullptr)
+        {
+            std::destroy(begin(), end());
+            deallocate(m_data, m_capacity);
+        }
+    }
+
+    T* m_data = nullptr;
+    size_type m_size = 0;
+    size_type m_capacity = 0;
+};
+
+}  // namespace stronger
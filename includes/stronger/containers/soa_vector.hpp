@@ -0,0 +1,333 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+#include <algorithm>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace stronger
+{
+
+namespace concepts
+{
+
+/// Types that appear exactly once in Fields...
+template <typename Field, typename... Fields>
+concept unique_field = ((std::same_as<Field, Fields> ? 1 : 0) + ... + 0) == 1;
+
+}  // namespace concepts
+
+/**
+ * Vector of records stored as one contiguous column per field (structure of arrays).
+ * Columns are selected by type: `v.column<Quantity>()` is a std::span over all the quantities, which makes scans over
+ * one field as fast as over a plain array.
+ * Rows are tuples of references to one element of each column, which work with structured bindings.
+ *
+ * @tparam Fields Types of the fields of a record, usually different strong types. Each type must appear once
+ */
+template <typename... Fields>
+    requires(sizeof...(Fields) > 0) && (concepts::unique_field<Fields, Fields...> && ...) &&
+            (!(std::same_as<Fields, bool> || ...))  // std::vector<bool> is not contiguous
+class soa_vector
+{
+    template <bool IsConst>
+    class basic_iterator;
+
+public:
+
+    using value_type = std::tuple<Fields...>;
+    using reference = std::tuple<Fields&...>;
+    using const_reference = std::tuple<const Fields&...>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    constexpr soa_vector() = default;
+
+    constexpr soa_vector(std::initializer_list<value_type> rows)
+    {
+        reserve(rows.size());
+        for(const value_type& row : rows)
+            push_back(row);
+    }
+
+    // Columns .........................................................................................................
+
+    template <typename Field>
+        requires concepts::unique_field<Field, Fields...>
+    [[nodiscard]] constexpr std::span<Field> column() noexcept
+    {
+        return std::get<std::vector<Field>>(m_columns);
+    }
+
+    template <typename Field>
+        requires concepts::unique_field<Field, Fields...>
+    [[nodiscard]] constexpr std::span<const Field> column() const noexcept
+    {
+        return std::get<std::vector<Field>>(m_columns);
+    }
+
+    // Rows ............................................................................................................
+
+    [[nodiscard]] constexpr reference operator[](const size_type position) noexcept
+    {
+        return reference{ std::get<std::vector<Fields>>(m_columns)[position]... };
+    }
+
+    [[nodiscard]] constexpr const_reference operator[](const size_type position) const noexcept
+    {
+        return const_reference{ std::get<std::vector<Fields>>(m_columns)[position]... };
+    }
+
+    [[nodiscard]] constexpr reference front() noexcept { return (*this)[0]; }
+
+    [[nodiscard]] constexpr const_reference front() const noexcept { return (*this)[0]; }
+
+    [[nodiscard]] constexpr reference back() noexcept { return (*this)[size() - 1]; }
+
+    [[nodiscard]] constexpr const_reference back() const noexcept { return (*this)[size() - 1]; }
+
+    [[nodiscard]] constexpr iterator begin() noexcept { return iterator{ this, 0 }; }
+
+    [[nodiscard]] constexpr const_iterator begin() const noexcept { return const_iterator{ this, 0 }; }
+
+    [[nodiscard]] constexpr iterator end() noexcept { return iterator{ this, size() }; }
+
+    [[nodiscard]] constexpr const_iterator end() const noexcept { return const_iterator{ this, size() }; }
+
+    // Size and capacity ...............................................................................................
+
+    [[nodiscard]] constexpr size_type size() const noexcept { return std::get<0>(m_columns).size(); }
+
+    [[nodiscard]] constexpr bool empty() const noexcept { return std::get<0>(m_columns).empty(); }
+
+    /// Number of rows that can be added to every column without reallocation
+    [[nodiscard]] constexpr size_type capacity() const noexcept
+    {
+        size_type result = std::get<0>(m_columns).capacity();
+        ((result = std::min(result, std::get<std::vector<Fields>>(m_columns).capacity())), ...);
+        return result;
+    }
+
+    constexpr void reserve(const size_type capacity)
+    {
+        (std::get<std::vector<Fields>>(m_columns).reserve(capacity), ...);
+    }
+
+    constexpr void shrink_to_fit() { (std::get<std::vector<Fields>>(m_columns).shrink_to_fit(), ...); }
+
+    // Modifiers .......................................................................................................
+
+    /// Constructs one field from each argument, in the order of Fields.
+    /// If a constructor throws, the columns that already grew are shrunk back: the vector is left unchanged.
+    template <typename... Args>
+        requires(sizeof...(Args) == sizeof...(Fields)) && (std::constructible_from<Fields, Args &&> && ...)
+    constexpr reference emplace_back(Args&&... args)
+    {
+        const size_type count = size();
+        try
+        {
+            (std::get<std::vector<Fields>>(m_columns).emplace_back(std::forward<Args>(args)), ...);
+        }
+        catch(...)
+        {
+            truncate(count);
+            throw;
+        }
+        return back();
+    }
+
+    constexpr void push_back(const Fields&... fields) { emplace_back(fields...); }
+
+    constexpr void push_back(Fields&&... fields) { emplace_back(std::move(fields)...); }
+
+    constexpr void push_back(const value_type& row)
+    {
+        std::apply([this](const Fields&... fields) { emplace_back(fields...); }, row);
+    }
+
+    constexpr void push_back(value_type&& row)
+    {
+        std::apply([this](Fields&... fields) { emplace_back(std::move(fields)...); }, row);
+    }
+
+    constexpr void pop_back() { (std::get<std::vector<Fields>>(m_columns).pop_back(), ...); }
+
+    constexpr void resize(const size_type count)
+    {
+        const size_type previous = size();
+        try
+        {
+            (std::get<std::vector<Fields>>(m_columns).resize(count), ...);
+        }
+        catch(...)
+        {
+            truncate(previous);
+            throw;
+        }
+    }
+
+    constexpr void clear() noexcept { (std::get<std::vector<Fields>>(m_columns).clear(), ...); }
+
+    [[nodiscard]] constexpr friend bool operator==(const soa_vector& lhs, const soa_vector& rhs) = default;
+
+private:
+
+    /// Removes the rows from `count`, in the columns that have more
+    constexpr void truncate(const size_type count) noexcept
+    {
+        (
+            [count](std::vector<Fields>& column) {
+                while(column.size() > count)
+                    column.pop_back();
+            }(std::get<std::vector<Fields>>(m_columns)),
+            ...);
+    }
+
+    std::tuple<std::vector<Fields>...> m_columns;
+
+    /// Random access iterator over the rows. It holds the vector and a position: dereferencing it gives a tuple of
+    /// references to the elements of each column at this position.
+    template <bool IsConst>
+    class basic_iterator
+    {
+        using owner = std::conditional_t<IsConst, const soa_vector, soa_vector>;
+        friend soa_vector;
+
+        constexpr basic_iterator(owner* const vector, const size_type position) noexcept :
+                m_vector(vector),
+                m_position(position)
+        {
+        }
+
+    public:
+
+        using value_type = soa_vector::value_type;
+        using reference = std::conditional_t<IsConst, soa_vector::const_reference, soa_vector::reference>;
+        using difference_type = soa_vector::difference_type;
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag;  // Dereferencing gives a tuple, not a reference
+
+        constexpr basic_iterator() = default;
+
+        /// iterator converts to const_iterator
+        template <bool OtherIsConst>
+            requires IsConst && (!OtherIsConst)
+        constexpr explicit(false) basic_iterator(const basic_iterator<OtherIsConst>& other) noexcept :
+                m_vector(other.m_vector),
+                m_position(other.m_position)
+        {
+        }
+
+        [[nodiscard]] constexpr reference operator*() const noexcept { return (*m_vector)[m_position]; }
+
+        [[nodiscard]] constexpr reference operator[](const difference_type offset) const noexcept
+        {
+            return *(*this + offset);
+        }
+
+        constexpr basic_iterator& operator++() noexcept
+        {
+            ++m_position;
+            return *this;
+        }
+
+        constexpr basic_iterator operator++(int) noexcept
+        {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        constexpr basic_iterator& operator--() noexcept
+        {
+            --m_position;
+            return *this;
+        }
+
+        constexpr basic_iterator operator--(int) noexcept
+        {
+            auto copy = *this;
+            --*this;
+            return copy;
+        }
+
+        constexpr basic_iterator& operator+=(const difference_type offset) noexcept
+        {
+            m_position = static_cast<size_type>(static_cast<difference_type>(m_position) + offset);
+            return *this;
+        }
+
+        constexpr basic_iterator& operator-=(const difference_type offset) noexcept { return *this += -offset; }
+
+        [[nodiscard]] constexpr friend basic_iterator operator+(basic_iterator iterator,
+                                                                const difference_type offset) noexcept
+        {
+            return iterator += offset;
+        }
+
+        [[nodiscard]] constexpr friend basic_iterator operator+(const difference_type offset,
+                                                                basic_iterator iterator) noexcept
+        {
+            return iterator += offset;
+        }
+
+        [[nodiscard]] constexpr friend basic_iterator operator-(basic_iterator iterator,
+                                                                const difference_type offset) noexcept
+        {
+            return iterator -= offset;
+        }
+
+        [[nodiscard]] constexpr friend difference_type operator-(const basic_iterator& lhs,
+                                                                 const basic_iterator& rhs) noexcept
+        {
+            return static_cast<difference_type>(lhs.m_position) - static_cast<difference_type>(rhs.m_position);
+        }
+
+        [[nodiscard]] constexpr friend bool operator==(const basic_iterator& lhs, const basic_iterator& rhs) noexcept
+        {
+            return lhs.m_position == rhs.m_position;
+        }
+
+        [[nodiscard]] constexpr friend auto operator<=>(const basic_iterator& lhs, const basic_iterator& rhs) noexcept
+        {
+            return lhs.m_position <=> rhs.m_position;
+        }
+
+        /// Moves each field, so that algorithms like std::ranges::sort move rows instead of copying them
+        [[nodiscard]] constexpr friend auto iter_move(const basic_iterator& iterator) noexcept
+        {
+            using rvalue_reference =
+                std::conditional_t<IsConst, std::tuple<const Fields&&...>, std::tuple<Fields&&...>>;
+            return rvalue_reference{ std::move(iterator.m_vector->template column<Fields>()[iterator.m_position])... };
+        }
+
+        constexpr friend void iter_swap(const basic_iterator& lhs, const basic_iterator& rhs)
+            noexcept((std::is_nothrow_swappable_v<Fields> && ...))
+            requires(!IsConst)
+        {
+            (std::ranges::swap(lhs.m_vector->template column<Fields>()[lhs.m_position],
+                               rhs.m_vector->template column<Fields>()[rhs.m_position]),
+             ...);
+        }
+
+    private:
+
+        friend class basic_iterator<true>;
+
+        owner* m_vector = nullptr;
+        size_type m_position = 0;
+    };
+};
+
+}  // namespace stronger
@@ -0,0 +1,35 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+#include "stronger/containers/indexed_container.hpp"
+#include <array>
+#include <cstddef>
+
+namespace stronger
+{
+
+/**
+ * std::array that can only be subscripted by Index, and whose size is an Index.
+ * Iterating over it yields (index, value) pairs. Use `*a` to access the underlying std::array.
+ *
+ * @tparam Index Strong type of integral underlying type
+ * @tparam T Type of the elements
+ * @tparam N Number of elements
+ * @tparam Options options to enable. Use options::bounds_checked to check indices on subscripting
+ */
+template <concepts::strong_index Index, typename T, std::size_t N, options... Options>
+class strong_array : public internal::indexed_container<std::array<T, N>, Index, Options...>
+{
+    using base = internal::indexed_container<std::array<T, N>, Index, Options...>;
+
+public:
+
+    constexpr strong_array() = default;
+
+    constexpr explicit strong_array(const std::array<T, N>& values) : base(values) {}
+
+    constexpr void fill(const T& value) { this->m_data.fill(value); }
+};
+
+}  // namespace stronger
@@ -0,0 +1,63 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+#include "stronger/containers/indexed_container.hpp"
+#include "stronger/containers/strong_array.hpp"
+#include "stronger/containers/strong_vector.hpp"
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace stronger
+{
+
+/**
+ * std::span that can only be subscripted by Index, and whose size is an Index.
+ * Iterating over it yields (index, value) pairs. Use `*s` to access the underlying std::span.
+ *
+ * @tparam Index Strong type of integral underlying type
+ * @tparam T Type of the elements, const-qualified for read-only views
+ * @tparam Options options to enable. Use options::bounds_checked to check indices on subscripting
+ */
+template <concepts::strong_index Index, typename T, options... Options>
+class strong_span : public internal::indexed_container<std::span<T>, Index, Options...>
+{
+    using base = internal::indexed_container<std::span<T>, Index, Options...>;
+
+public:
+
+    constexpr strong_span() = default;
+
+    constexpr explicit strong_span(const std::span<T> values) : base(values) {}
+
+    template <options... VectorOptions>
+    constexpr explicit(false) strong_span(strong_vector<Index, std::remove_const_t<T>, VectorOptions...>& values) :
+            base(std::span<T>(*values))
+    {
+    }
+
+    template <options... VectorOptions>
+        requires std::is_const_v<T>
+    constexpr explicit(false)
+        strong_span(const strong_vector<Index, std::remove_const_t<T>, VectorOptions...>& values) :
+            base(std::span<T>(*values))
+    {
+    }
+
+    template <std::size_t N, options... ArrayOptions>
+    constexpr explicit(false) strong_span(strong_array<Index, std::remove_const_t<T>, N, ArrayOptions...>& values) :
+            base(std::span<T>(*values))
+    {
+    }
+
+    template <std::size_t N, options... ArrayOptions>
+        requires std::is_const_v<T>
+    constexpr explicit(false)
+        strong_span(const strong_array<Index, std::remove_const_t<T>, N, ArrayOptions...>& values) :
+            base(std::span<T>(*values))
+    {
+    }
+};
+
+}  // namespace stronger
@@ -0,0 +1,69 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+#include "stronger/containers/indexed_container.hpp"
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+namespace stronger
+{
+
+/**
+ * std::vector that can only be subscripted by Index, and whose size is an Index.
+ * Iterating over it yields (index, value) pairs. Use `*v` to access the underlying std::vector.
+ *
+ * @tparam Index Strong type of integral underlying type
+ * @tparam T Type of the elements
+ * @tparam Options options to enable. Use options::bounds_checked to check indices on subscripting
+ */
+template <concepts::strong_index Index, typename T, options... Options>
+class strong_vector : public internal::indexed_container<std::vector<T>, Index, Options...>
+{
+    using base = internal::indexed_container<std::vector<T>, Index, Options...>;
+
+public:
+
+    constexpr strong_vector() = default;
+
+    constexpr explicit strong_vector(const Index count) : base(std::vector<T>(base::to_position(count))) {}
+
+    constexpr strong_vector(const Index count, const T& value) :
+            base(std::vector<T>(base::to_position(count), value))
+    {
+    }
+
+    constexpr strong_vector(std::initializer_list<T> values) : base(std::vector<T>(values)) {}
+
+    constexpr explicit strong_vector(std::vector<T> values) : base(std::move(values)) {}
+
+    constexpr void push_back(const T& value) { this->m_data.push_back(value); }
+
+    constexpr void push_back(T&& value) { this->m_data.push_back(std::move(value)); }
+
+    template <typename... Args>
+    constexpr T& emplace_back(Args&&... args)
+    {
+        return this->m_data.emplace_back(std::forward<Args>(args)...);
+    }
+
+    constexpr void pop_back() { this->m_data.pop_back(); }
+
+    constexpr void reserve(const Index capacity) { this->m_data.reserve(base::to_position(capacity)); }
+
+    constexpr void resize(const Index count) { this->m_data.resize(base::to_position(count)); }
+
+    constexpr void resize(const Index count, const T& value)
+    {
+        this->m_data.resize(base::to_position(count), value);
+    }
+
+    constexpr void clear() noexcept { this->m_data.clear(); }
+
+    [[nodiscard]] constexpr decltype(auto) front(this auto&& self) { return self.m_data.front(); }
+
+    [[nodiscard]] constexpr decltype(auto) back(this auto&& self) { return self.m_data.back(); }
+};
+
+}  // namespace stronger
@@ -0,0 +1,10 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+// Minimal header to declare and use strong types.
+// Formatting, stream insertion and hashing are opt-in: include stronger/format.hpp, stronger/iostream.hpp and
+// stronger/hash.hpp, or stronger.hpp for the three of them. Other features have their own header in includes/stronger/.
+
+#pragma once
+#include "strong_type.hpp"
+#include "tag.hpp"
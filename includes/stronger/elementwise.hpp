@@ -0,0 +1,256 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+#include "strong_type.hpp"
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <ranges>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace stronger
+{
+
+namespace traits
+{
+
+template <typename T>
+constexpr bool is_elementwise_expression_impl = false;
+
+template <size_t Tag, typename Operation, typename... Operands>
+constexpr bool is_elementwise_expression_impl<elementwise_expression<Tag, Operation, Operands...>> = true;
+
+template <typename T>
+constexpr bool is_elementwise_expression = is_elementwise_expression_impl<std::remove_cvref_t<T>>;
+
+}  // namespace traits
+
+namespace concepts
+{
+
+/// Contiguous ranges of arithmetic values, that elementwise expressions can read from and write to
+template <typename Range>
+concept elementwise_range = std::ranges::contiguous_range<Range> && std::ranges::sized_range<Range> &&
+                            std::is_arithmetic_v<std::ranges::range_value_t<Range>>;
+
+/// Strong type of a range, with options::elementwise enabled
+template <typename StrongType>
+concept elementwise_strong_type =
+    traits::is_strong_type<StrongType> &&
+    traits::strong_type_info<std::remove_cvref_t<StrongType>>::template has_option<options::elementwise> &&
+    elementwise_range<typename std::remove_cvref_t<StrongType>::underlying_type>;
+
+/// Operands of elementwise arithmetic operators
+template <typename Operand>
+concept elementwise_operand = elementwise_strong_type<Operand> || traits::is_elementwise_expression<Operand>;
+
+}  // namespace concepts
+
+namespace internal
+{
+
+/// Reads the elements of an elementwise strong type
+template <typename T>
+class elementwise_leaf
+{
+public:
+
+    using value_type = T;
+
+    constexpr elementwise_leaf(const T* data, const size_t size) noexcept :
+            m_data(data),
+            m_size(size)
+    {
+    }
+
+    [[nodiscard]] constexpr size_t size() const noexcept { return m_size; }
+
+    [[nodiscard]] constexpr T operator[](const size_t i) const noexcept { return m_data[i]; }
+
+private:
+
+    const T* m_data;
+    size_t m_size;
+};
+
+template <typename Operand>
+struct elementwise_info
+{
+    static constexpr size_t tag = traits::strong_type_info<Operand>::tag;
+    using node = elementwise_leaf<std::ranges::range_value_t<typename Operand::underlying_type>>;
+};
+
+template <size_t Tag, typename Operation, typename... Operands>
+struct elementwise_info<elementwise_expression<Tag, Operation, Operands...>>
+{
+    static constexpr size_t tag = Tag;
+    using node = elementwise_expression<Tag, Operation, Operands...>;
+};
+
+template <typename Operand>
+constexpr size_t elementwise_tag = elementwise_info<std::remove_cvref_t<Operand>>::tag;
+
+template <typename Operand>
+using elementwise_node = elementwise_info<std::remove_cvref_t<Operand>>::node;
+
+/// Expressions only hold references to the elements of strong types, and copies of sub-expressions
+template <typename Operand>
+[[nodiscard]] constexpr elementwise_node<Operand> to_elementwise_node(Operand&& operand) noexcept
+{
+    if constexpr(traits::is_elementwise_expression<Operand>)
+        return std::forward<Operand>(operand);
+    else
+        return { std::ranges::data(*operand), std::ranges::size(*operand) };
+}
+
+/// Operands are elementwise operands with the same tag, on the same value type
+template <typename First, typename... Rest>
+concept elementwise_compatible =
+    concepts::elementwise_operand<First> && (concepts::elementwise_operand<Rest> && ...) &&
+    ((elementwise_tag<Rest> == elementwise_tag<First>) && ...) &&
+    (std::same_as<typename elementwise_node<Rest>::value_type, typename elementwise_node<First>::value_type> && ...);
+
+template <typename Operation, typename First, typename... Rest>
+[[nodiscard]] constexpr auto make_elementwise_expression(First&& first, Rest&&... rest)
+{
+    using expression =
+        elementwise_expression<elementwise_tag<First>, Operation, elementwise_node<First>, elementwise_node<Rest>...>;
+    return expression{ to_elementwise_node(std::forward<First>(first)),
+                       to_elementwise_node(std::forward<Rest>(rest))... };
+}
+
+}  // namespace internal
+
+/**
+ * Lazy elementwise arithmetic expression on strong types with options::elementwise.
+ * Nothing is computed until the expression is assigned to a strong type with the same tag: all the operations are
+ * then evaluated in a single loop, without any temporary range.
+ *
+ * Expressions refer to the elements of their operands: they must not outlive them. Avoid storing them in `auto`
+ * variables.
+ *
+ * @tparam Tag Tag shared by all the operands
+ * @tparam Operation Function object applied to the elements of the operands
+ * @tparam Operands Leaves or sub-expressions
+ */
+template <size_t Tag, typename Operation, typename... Operands>
+class elementwise_expression
+{
+public:
+
+    using value_type = std::tuple_element_t<0, std::tuple<typename Operands::value_type...>>;
+    static constexpr size_t tag = Tag;
+
+    /// @throws std::length_error If the operands have different sizes
+    constexpr explicit elementwise_expression(Operands... operands) :
+            m_operands(std::move(operands)...),
+            m_size(std::get<0>(m_operands).size())
+    {
+        const bool sameSizes =
+            std::apply([this](const Operands&... nodes) { return ((nodes.size() == m_size) && ...); }, m_operands);
+        if(!sameSizes)
+            throw std::length_error("stronger: elementwise operands have different sizes");
+    }
+
+    [[nodiscard]] constexpr size_t size() const noexcept { return m_size; }
+
+    [[nodiscard]] constexpr value_type operator[](const size_t i) const noexcept
+    {
+        return std::apply(
+            [i](const Operands&... nodes) -> value_type
+            {
+                // Integral promotions may widen the result of the operation
+                using result_type = decltype(Operation{}(nodes[i]...));
+                if constexpr(std::same_as<result_type, value_type>)
+                    return Operation{}(nodes[i]...);
+                else
+                    return static_cast<value_type>(Operation{}(nodes[i]...));
+            },
+            m_operands);
+    }
+
+    /**
+     * Evaluates the expression into `out`, in a single loop.
+     * Resizable ranges are resized to the size of the expression. Other ranges must already have this size.
+     *
+     * @throws std::length_error If `out` cannot be resized, and does not have the size of the expression
+     */
+    template <concepts::elementwise_strong_type Out>
+        requires(traits::strong_type_info<std::remove_cvref_t<Out>>::tag == Tag) &&
+                std::same_as<std::ranges::range_value_t<typename std::remove_cvref_t<Out>::underlying_type>,
+                             value_type> &&
+                std::is_assignable_v<std::ranges::range_reference_t<decltype(*std::declval<Out&>())>, value_type>
+    constexpr void evaluate_into(Out&& out) const
+    {
+        auto& range = *out;
+        if constexpr(requires { range.resize(m_size); })
+            range.resize(m_size);
+        else if(std::ranges::size(range) != m_size)
+            throw std::length_error("stronger: elementwise output does not have the size of the expression");
+
+        auto* const data = std::ranges::data(range);
+        for(size_t i = 0; i < m_size; ++i)
+            data[i] = (*this)[i];
+    }
+
+    /// Evaluates the expression into a new strong type with the same tag
+    template <concepts::elementwise_strong_type Result>
+        requires(!std::is_reference_v<Result>) && std::default_initializable<Result> &&
+                requires(const elementwise_expression& expression, Result& result) {
+                    expression.evaluate_into(result);
+                }
+    [[nodiscard]] explicit(false) constexpr operator Result() const
+    {
+        Result result{};
+        evaluate_into(result);
+        return result;
+    }
+
+private:
+
+    std::tuple<Operands...> m_operands;
+    size_t m_size;
+};
+
+// Elementwise arithmetic operators ____________________________________________________________________________________
+
+template <typename Operand>
+    requires internal::elementwise_compatible<Operand>
+[[nodiscard]] constexpr auto operator-(Operand&& operand)
+{
+    return internal::make_elementwise_expression<std::negate<>>(std::forward<Operand>(operand));
+}
+
+template <typename Lhs, typename Rhs>
+    requires internal::elementwise_compatible<Lhs, Rhs>
+[[nodiscard]] constexpr auto operator+(Lhs&& lhs, Rhs&& rhs)
+{
+    return internal::make_elementwise_expression<std::plus<>>(std::forward<Lhs>(lhs), std::forward<Rhs>(rhs));
+}
+
+template <typename Lhs, typename Rhs>
+    requires internal::elementwise_compatible<Lhs, Rhs>
+[[nodiscard]] constexpr auto operator-(Lhs&& lhs, Rhs&& rhs)
+{
+    return internal::make_elementwise_expression<std::minus<>>(std::forward<Lhs>(lhs), std::forward<Rhs>(rhs));
+}
+
+template <typename Lhs, typename Rhs>
+    requires internal::elementwise_compatible<Lhs, Rhs>
+[[nodiscard]] constexpr auto operator*(Lhs&& lhs, Rhs&& rhs)
+{
+    return internal::make_elementwise_expression<std::multiplies<>>(std::forward<Lhs>(lhs), std::forward<Rhs>(rhs));
+}
+
+template <typename Lhs, typename Rhs>
+    requires internal::elementwise_compatible<Lhs, Rhs>
+[[nodiscard]] constexpr auto operator/(Lhs&& lhs, Rhs&& rhs)
+{
+    return internal::make_elementwise_expression<std::divides<>>(std::forward<Lhs>(lhs), std::forward<Rhs>(rhs));
+}
+
+}  // namespace stronger
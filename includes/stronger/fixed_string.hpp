@@ -0,0 +1,199 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+#include "strong_type.hpp"
+#include <array>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iosfwd>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+namespace stronger
+{
+
+/**
+ * String of at most N characters, stored inline: it never allocates.
+ * Unused characters are kept at 0, so that comparison and hashing read whole 8-byte words, with no loop over
+ * characters nor branch on the size.
+ *
+ * @tparam N Maximum number of characters
+ */
+template <std::size_t N>
+    requires(N > 0)
+class fixed_string
+{
+    static constexpr std::size_t word_count = (N + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+    using stored_size_type =
+        std::conditional_t<N <= UINT8_MAX, uint8_t, std::conditional_t<N <= UINT16_MAX, uint16_t, std::size_t>>;
+
+public:
+
+    using value_type = char;
+    using size_type = std::size_t;
+    using const_iterator = const char*;
+    using iterator = const_iterator;
+
+    constexpr fixed_string() noexcept = default;
+
+    /// String literals are checked at compile time. Like a literal, the array ends at its first null character: a
+    /// `char[16]` holding "AB" gives "AB"
+    template <std::size_t Size>
+        requires(Size - 1 <= N)
+    constexpr explicit(false) fixed_string(const char (&literal)[Size]) noexcept :
+            fixed_string(until_null(std::string_view(literal, Size - 1)), trusted)
+    {
+    }
+
+    /// @throws std::length_error If `text` has more than N characters
+    constexpr explicit fixed_string(const std::string_view text) :
+            fixed_string(checked(text), trusted)
+    {
+    }
+
+    [[nodiscard]] static constexpr size_type capacity() noexcept { return N; }
+
+    [[nodiscard]] static constexpr size_type max_size() noexcept { return N; }
+
+    [[nodiscard]] constexpr size_type size() const noexcept { return m_size; }
+
+    [[nodiscard]] constexpr size_type length() const noexcept { return m_size; }
+
+    [[nodiscard]] constexpr bool empty() const noexcept { return m_size == 0; }
+
+    /// Characters, followed by null characters if size() < N
+    [[nodiscard]] constexpr const char* data() const noexcept { return m_chars.data(); }
+
+    [[nodiscard]] constexpr const_iterator begin() const noexcept { return m_chars.data(); }
+
+    [[nodiscard]] constexpr const_iterator end() const noexcept { return m_chars.data() + m_size; }
+
+    [[nodiscard]] constexpr char operator[](const size_type position) const noexcept { return m_chars[position]; }
+
+    [[nodiscard]] constexpr std::string_view view() const noexcept { return { m_chars.data(), m_size }; }
+
+    [[nodiscard]] constexpr explicit(false) operator std::string_view() const noexcept { return view(); }
+
+    constexpr void clear() noexcept { *this = fixed_string{}; }
+
+    /// Hash of the characters, mixed one word at a time
+    [[nodiscard]] constexpr std::size_t hash() const noexcept
+    {
+        uint64_t mixed = (uint64_t{ m_size } + 1) * 0x9e3779b97f4a7c15ULL;
+        for(std::size_t i = 0; i < word_count; ++i)
+        {
+            mixed = (mixed ^ word(i)) * 0xff51afd7ed558ccdULL;
+            mixed ^= mixed >> 32;
+        }
+        return internal::cast<std::size_t>(mixed);
+    }
+
+    /// Compares whole words: characters are equal if their words are, since the unused ones are 0
+    [[nodiscard]] constexpr friend bool operator==(const fixed_string& lhs, const fixed_string& rhs) noexcept
+    {
+        bool equal = lhs.m_size == rhs.m_size;
+        for(std::size_t i = 0; i < word_count; ++i)
+            equal &= lhs.word(i) == rhs.word(i);
+        return equal;
+    }
+
+    /// Lexicographic order of the characters as unsigned char, like std::string
+    [[nodiscard]] constexpr friend std::strong_ordering operator<=>(const fixed_string& lhs,
+                                                                    const fixed_string& rhs) noexcept
+    {
+        for(std::size_t i = 0; i < word_count; ++i)
+        {
+            // Words hold their first character in their least significant byte: reversed, they compare like strings
+            if(const uint64_t left = lhs.word(i), right = rhs.word(i); left != right)
+                return std::byteswap(left) <=> std::byteswap(right);
+        }
+        // Same characters, followed by null characters
+        return lhs.m_size <=> rhs.m_size;
+    }
+
+private:
+
+    struct trusted_t
+    {
+    };
+
+    static constexpr trusted_t trusted{};
+
+    constexpr fixed_string(const std::string_view text, trusted_t) noexcept :
+            m_size(internal::cast<stored_size_type>(text.size()))
+    {
+        for(std::size_t i = 0; i < text.size(); ++i)
+            m_chars[i] = text[i];
+    }
+
+    /// Characters of `text` before its first null character
+    [[nodiscard]] static constexpr std::string_view until_null(const std::string_view text) noexcept
+    {
+        return text.substr(0, text.find('\0'));
+    }
+
+    [[nodiscard]] static constexpr std::string_view checked(const std::string_view text)
+    {
+        if(text.size() > N)
+            throw std::length_error("stronger: string too long for fixed_string");
+        return text;
+    }
+
+    /// Word `index` of the characters, with its first character in its least significant byte on every platform
+    [[nodiscard]] constexpr uint64_t word(const std::size_t index) const noexcept
+    {
+        if consteval
+        {
+            uint64_t result = 0;
+            for(std::size_t i = 0; i < sizeof(uint64_t); ++i)
+                result |= uint64_t{ static_cast<unsigned char>(m_chars[index * sizeof(uint64_t) + i]) } << (8 * i);
+            return result;
+        }
+        else
+        {
+            uint64_t result = 0;
+            std::memcpy(&result, m_chars.data() + index * sizeof(uint64_t), sizeof(uint64_t));
+            if constexpr(std::endian::native == std::endian::big)
+                result = std::byteswap(result);
+            return result;
+        }
+    }
+
+    std::array<char, word_count * sizeof(uint64_t)> m_chars{};
+    stored_size_type m_size = 0;
+};
+
+/// Strong type of a string of at most N characters, stored inline
+template <std::size_t N, std::size_t Tag, options... Options>
+using fixed_string_type = strong_type<fixed_string<N>, Tag, Options...>;
+
+template <std::size_t N>
+std::ostream& operator<<(std::ostream& os, const fixed_string<N>& rhs)
+{
+    return os << rhs.view();
+}
+
+namespace traits
+{
+
+template <std::size_t N>
+constexpr bool formats_as_string_view<fixed_string<N>> = true;
+
+}  // namespace traits
+
+}  // namespace stronger
+
+template <std::size_t N>
+struct std::hash<stronger::fixed_string<N>>
+{
+    constexpr hash() = default;
+    static constexpr auto operator()(const stronger::fixed_string<N>& s) noexcept
+    {
+        return s.hash();
+    }
+};
@@ -0,0 +1,61 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+#include "strong_type.hpp"
+#include <concepts>
+#include <format>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace stronger::concepts
+{
+
+template <typename T>
+concept supports_std_format = requires(const T& value) {
+    { std::format("{}", value) };
+};
+
+/// Types that opted in with traits::formats_as_string_view, like fixed_string and interned
+template <typename T>
+concept formattable_as_string_view = traits::formats_as_string_view<T> && requires(const T& value) {
+    { value.view() } -> std::convertible_to<std::string_view>;
+};
+
+/// Types that opted in with traits::formats_as_value, like bounded
+template <typename T>
+concept formattable_as_value = traits::formats_as_value<T> && requires(const T& value) {
+    { std::format("{}", *value) };
+};
+
+}  // namespace stronger::concepts
+
+template <stronger::concepts::supports_std_format T, size_t Tag, stronger::options... Options>
+struct std::formatter<stronger::strong_type<T, Tag, Options...>> : std::formatter<T>
+{
+    auto format(const stronger::strong_type<T, Tag, Options...>& s, std::format_context& ctx) const
+    {
+        return std::formatter<T>::format(*s, ctx);
+    }
+};
+
+template <typename T>
+    requires stronger::concepts::formattable_as_string_view<T>
+struct std::formatter<T> : std::formatter<std::string_view>
+{
+    auto format(const T& s, std::format_context& ctx) const
+    {
+        return std::formatter<std::string_view>::format(s.view(), ctx);
+    }
+};
+
+template <typename T>
+    requires stronger::concepts::formattable_as_value<T>
+struct std::formatter<T> : std::formatter<std::remove_cvref_t<decltype(*std::declval<const T&>())>>
+{
+    auto format(const T& s, std::format_context& ctx) const
+    {
+        return std::formatter<std::remove_cvref_t<decltype(*s)>>::format(*s, ctx);
+    }
+};
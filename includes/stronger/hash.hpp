@@ -0,0 +1,26 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+#include "strong_type.hpp"
+#include <functional>
+
+namespace stronger::concepts
+{
+
+template <typename T>
+concept supports_std_hash = requires(const T& value) {
+    { std::hash<T>{}(value) };
+};
+
+}  // namespace stronger::concepts
+
+template <stronger::concepts::supports_std_hash T, size_t Tag, stronger::options... Options>
+struct std::hash<stronger::strong_type<T, Tag, Options...>>
+{
+    constexpr hash() = default;
+    static constexpr auto operator()(const stronger::strong_type<T, Tag, Options...>& s) noexcept
+    {
+        return std::hash<T>{}(*s);
+    }
+};
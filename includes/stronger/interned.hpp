@@ -0,0 +1,247 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+#include "traits/traits.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iosfwd>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace stronger
+{
+
+namespace internal
+{
+
+/**
+ * Set of unique strings, each identified by a 32-bit handle. Handle 0 is the empty string.
+ * Strings are copied in blocks of memory that are never freed nor moved, so the views of interned strings stay valid
+ * until the pool is destroyed.
+ *
+ * Interning is thread-safe. Getting the string of a handle does not lock: handles index a table made of segments of
+ * growing sizes, that never move once allocated.
+ */
+class intern_pool
+{
+public:
+
+    intern_pool() { static_cast<void>(intern({})); }
+
+    intern_pool(const intern_pool&) = delete;
+    intern_pool& operator=(const intern_pool&) = delete;
+
+    ~intern_pool()
+    {
+        for(std::atomic<std::string_view*>& segment : m_segments)
+            delete[] segment.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Handle of `text`, that is copied in the pool if it is not there yet
+     *
+     * @throws std::length_error If the pool already holds 2^32 strings
+     */
+    [[nodiscard]] uint32_t intern(const std::string_view text)
+    {
+        {
+            const std::shared_lock lock(m_mutex);
+            if(const auto found = m_handles.find(text); found != m_handles.end())
+                return found->second;
+        }
+
+        const std::unique_lock lock(m_mutex);
+        if(const auto found = m_handles.find(text); found != m_handles.end())
+            return found->second;
+        if(m_size > std::numeric_limits<uint32_t>::max())
+            throw std::length_error("stronger: too many interned strings");
+        const auto handle = static_cast<uint32_t>(m_size);
+        const auto [segment, offset] = locate(handle);
+        if(offset == 0)
+            m_segments[segment].store(new std::string_view[segment_size(segment)], std::memory_order_release);
+        const std::string_view stored = store(text);
+        m_segments[segment].load(std::memory_order_relaxed)[offset] = stored;
+        m_handles.emplace(stored, handle);
+        ++m_size;
+        return handle;
+    }
+
+    /// String of a handle returned by intern()
+    [[nodiscard]] std::string_view view(const uint32_t handle) const noexcept
+    {
+        const auto [segment, offset] = locate(handle);
+        return m_segments[segment].load(std::memory_order_acquire)[offset];
+    }
+
+    /// Number of unique strings
+    [[nodiscard]] std::size_t size() const
+    {
+        const std::shared_lock lock(m_mutex);
+        return m_size;
+    }
+
+private:
+
+    static constexpr std::size_t first_segment_size = 1024;
+    static constexpr std::size_t block_size = 64 * 1024;
+    // Segment k holds first_segment_size * 2^k handles: 23 segments hold every 32-bit handle
+    static constexpr std::size_t segment_count = 23;
+
+    struct location
+    {
+        std::size_t segment;
+        std::size_t offset;
+    };
+
+    [[nodiscard]] static constexpr std::size_t segment_size(const std::size_t segment) noexcept
+    {
+        return first_segment_size << segment;
+    }
+
+    [[nodiscard]] static constexpr location locate(const uint32_t handle) noexcept
+    {
+        const std::size_t segment = std::bit_width(handle / first_segment_size + 1) - 1;
+        return { segment, handle - ((std::size_t{ 1 } << segment) - 1) * first_segment_size };
+    }
+
+    /// Copies `text` in the current block, or in a new one if it does not fit
+    [[nodiscard]] std::string_view store(const std::string_view text)
+    {
+        if(text.size() > m_free_size)
+        {
+            const std::size_t size = std::max(block_size, text.size());
+            m_blocks.push_back(std::make_unique_for_overwrite<char[]>(size));
+            m_free = m_blocks.back().get();
+            m_free_size = size;
+        }
+        if(!text.empty())
+            std::memcpy(m_free, text.data(), text.size());
+        const std::string_view stored(m_free, text.size());
+        m_free += text.size();
+        m_free_size -= text.size();
+        return stored;
+    }
+
+    mutable std::shared_mutex m_mutex;
+    std::unordered_map<std::string_view, uint32_t> m_handles;
+    std::array<std::atomic<std::string_view*>, segment_count> m_segments{};
+    std::size_t m_size = 0;
+    std::vector<std::unique_ptr<char[]>> m_blocks;
+    char* m_free = nullptr;
+    std::size_t m_free_size = 0;
+};
+
+}  // namespace internal
+
+/**
+ * Strong type of an immutable string, stored once in a pool shared by all the interned<Tag> values.
+ * Values are 4-byte handles: copies, equality and hashing are integer operations, and duplicated strings are stored
+ * once. operator* gives a std::string_view of the string, that stays valid until the end of the program.
+ *
+ * Constructing a value looks the string up in the pool, which is thread-safe. Interned strings are never freed.
+ *
+ * @tparam Tag Makes interned types different, each with its own pool. You can use tag() to set this parameter
+ */
+template <std::size_t Tag>
+class interned
+{
+    /// Makes operator-> return the address of a temporary std::string_view
+    struct arrow_proxy
+    {
+        std::string_view view;
+
+        [[nodiscard]] constexpr const std::string_view* operator->() const noexcept { return &view; }
+    };
+
+public:
+
+    using underlying_type = std::string_view;
+
+    /// Empty string
+    constexpr interned() noexcept = default;
+
+    explicit interned(const std::string_view text) :
+            m_handle(pool().intern(text))
+    {
+    }
+
+    [[nodiscard]] std::string_view operator*() const noexcept { return pool().view(m_handle); }
+
+    [[nodiscard]] std::string_view view() const noexcept { return **this; }
+
+    [[nodiscard]] arrow_proxy operator->() const noexcept { return { **this }; }
+
+    /// Identifies the string in its pool
+    [[nodiscard]] constexpr uint32_t handle() const noexcept { return m_handle; }
+
+    /// Number of unique strings of this type
+    [[nodiscard]] static std::size_t pool_size() { return pool().size(); }
+
+    [[nodiscard]] constexpr friend bool operator==(interned lhs, interned rhs) noexcept = default;
+
+    /// Lexicographic order of the strings
+    [[nodiscard]] friend std::strong_ordering operator<=>(const interned lhs, const interned rhs) noexcept
+    {
+        return lhs.m_handle == rhs.m_handle ? std::strong_ordering::equal : *lhs <=> *rhs;
+    }
+
+private:
+
+    [[nodiscard]] static internal::intern_pool& pool()
+    {
+        static internal::intern_pool instance;
+        return instance;
+    }
+
+    uint32_t m_handle = 0;
+};
+
+namespace traits
+{
+
+template <typename T>
+constexpr bool is_interned_impl = false;
+
+template <std::size_t Tag>
+constexpr bool is_interned_impl<interned<Tag>> = true;
+
+template <typename T>
+constexpr bool is_interned = is_interned_impl<std::remove_cvref_t<T>>;
+
+template <std::size_t Tag>
+constexpr bool formats_as_string_view<interned<Tag>> = true;
+
+}  // namespace traits
+
+template <std::size_t Tag>
+std::ostream& operator<<(std::ostream& os, const interned<Tag> rhs)
+{
+    return os << *rhs;
+}
+
+}  // namespace stronger
+
+/// Interned strings hash their handle, without reading the string
+template <std::size_t Tag>
+struct std::hash<stronger::interned<Tag>>
+{
+    constexpr hash() = default;
+    static constexpr auto operator()(const stronger::interned<Tag> s) noexcept
+    {
+        return std::hash<uint32_t>{}(s.handle());
+    }
+};
@@ -0,0 +1,28 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+#include "strong_type.hpp"
+#include <ostream>
+
+namespace stronger
+{
+
+namespace concepts
+{
+
+template <typename T>
+concept supports_ostream_insertion = requires(std::ostream& os, T a) {
+    { os << a } -> std::same_as<std::ostream&>;
+};
+
+}  // namespace concepts
+
+template <concepts::supports_ostream_insertion T, size_t Tag, options... Options>
+constexpr std::ostream& operator<<(std::ostream& os, const strong_type<T, Tag, Options...>& rhs)
+    noexcept(noexcept(os << *rhs))
+{
+    return os << *rhs;
+}
+
+}  // namespace stronger
@@ -0,0 +1,329 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+#include "strong_type.hpp"
+#include "stronger/span_cast.hpp"
+#include <array>
+#include <bit>
+#include <cerrno>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Binary files of one column of strong types, that are loaded by mapping them in memory.
+// A file is a 32-byte header followed by the values, in the byte order of the machine that wrote them.
+
+namespace stronger
+{
+
+namespace concepts
+{
+
+/// Integers and IEEE 754 floating point numbers of 8 bytes or less
+template <typename T>
+concept mappable_value = ((std::integral<T> && !std::same_as<T, bool>) ||
+                          (std::floating_point<T> && std::numeric_limits<T>::is_iec559)) &&
+                         sizeof(T) <= sizeof(uint64_t);
+
+/// Strong types whose arrays can be mapped from files
+template <typename S>
+concept mappable_strong_type = traits::is_strong_type<S> && !std::is_const_v<S> &&
+                               mappable_value<typename traits::strong_type_info<S>::underlying_type>;
+
+}  // namespace concepts
+
+namespace internal::mapped_file
+{
+
+enum class value_kind : uint8_t
+{
+    signed_integer = 1,
+    unsigned_integer = 2,
+    floating_point = 3,
+};
+
+enum class byte_order : uint8_t
+{
+    little = 1,
+    big = 2,
+};
+
+inline constexpr std::array<char, 8> magic = { 'S', 'T', 'R', 'O', 'N', 'G', 'E', 'R' };
+inline constexpr uint32_t version = 1;
+
+/// First bytes of the file. Values follow it, aligned for any type of 8 bytes or less
+struct header
+{
+    std::array<char, 8> magic;
+    uint32_t version;
+    value_kind kind;
+    uint8_t value_size;
+    byte_order order;
+    uint8_t reserved;
+    uint64_t tag;
+    uint64_t count;
+};
+
+static_assert(sizeof(header) == 32 && std::is_trivially_copyable_v<header>);
+
+template <typename T>
+[[nodiscard]] consteval value_kind kind_of() noexcept
+{
+    if constexpr(std::floating_point<T>)
+        return value_kind::floating_point;
+    else if constexpr(std::is_signed_v<T>)
+        return value_kind::signed_integer;
+    else
+        return value_kind::unsigned_integer;
+}
+
+[[nodiscard]] consteval byte_order native_order() noexcept
+{
+    static_assert(std::endian::native == std::endian::little || std::endian::native == std::endian::big,
+                  "stronger: mapped columns are not supported on mixed-endian platforms");
+    return std::endian::native == std::endian::little ? byte_order::little : byte_order::big;
+}
+
+template <typename S>
+[[nodiscard]] constexpr header header_of(const std::size_t count) noexcept
+{
+    using underlying_type = S::underlying_type;
+    return { magic,
+             version,
+             kind_of<underlying_type>(),
+             cast<uint8_t>(sizeof(underlying_type)),
+             native_order(),
+             0,
+             cast<uint64_t>(traits::strong_type_info<S>::tag),
+             cast<uint64_t>(count) };
+}
+
+[[noreturn]] inline void throw_invalid_file(const std::filesystem::path& path, const char* reason)
+{
+    throw std::runtime_error("stronger: " + path.string() + " is not a valid mapped column: " + reason);
+}
+
+/// Read-only mapping of a whole file in memory. The file can be closed once mapped
+class file_view
+{
+public:
+
+    explicit file_view(const std::filesystem::path& path)
+    {
+#ifdef _WIN32
+        const HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                        FILE_ATTRIBUTE_NORMAL, nullptr);
+        if(file == INVALID_HANDLE_VALUE)
+            throw_last_error(path);
+        LARGE_INTEGER size{};
+        if(!GetFileSizeEx(file, &size))
+            close_and_throw(file, path);
+        m_size = cast<std::size_t>(size.QuadPart);
+        if(m_size != 0)
+        {
+            const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if(mapping == nullptr)
+                close_and_throw(file, path);
+            m_data = static_cast<const std::byte*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+            CloseHandle(mapping);
+            if(m_data == nullptr)
+                close_and_throw(file, path);
+        }
+        CloseHandle(file);
+#else
+        const int file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if(file == -1)
+            throw_last_error(path);
+        struct stat status{};
+        if(::fstat(file, &status) == -1)
+            close_and_throw(file, path);
+        m_size = cast<std::size_t>(status.st_size);
+        if(m_size != 0)
+        {
+            void* const data = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, file, 0);
+            if(data == MAP_FAILED)
+                close_and_throw(file, path);
+            m_data = static_cast<const std::byte*>(data);
+        }
+        ::close(file);
+#endif
+    }
+
+    file_view(file_view&& other) noexcept :
+            m_data(std::exchange(other.m_data, nullptr)),
+            m_size(std::exchange(other.m_size, 0))
+    {
+    }
+
+    file_view& operator=(file_view&& other) noexcept
+    {
+        std::swap(m_data, other.m_data);
+        std::swap(m_size, other.m_size);
+        return *this;
+    }
+
+    ~file_view()
+    {
+        if(m_data == nullptr)
+            return;
+#ifdef _WIN32
+        UnmapViewOfFile(m_data);
+#else
+        ::munmap(const_cast<std::byte*>(m_data), m_size);
+#endif
+    }
+
+    [[nodiscard]] std::span<const std::byte> bytes() const noexcept { return { m_data, m_size }; }
+
+private:
+
+#ifdef _WIN32
+    [[noreturn]] static void throw_last_error(const std::filesystem::path& path)
+    {
+        throw std::system_error(cast<int>(GetLastError()), std::system_category(), path.string());
+    }
+
+    [[noreturn]] static void close_and_throw(const HANDLE file, const std::filesystem::path& path)
+    {
+        const DWORD error = GetLastError();
+        CloseHandle(file);
+        throw std::system_error(cast<int>(error), std::system_category(), path.string());
+    }
+#else
+    [[noreturn]] static void throw_last_error(const std::filesystem::path& path)
+    {
+        throw std::system_error(errno, std::system_category(), path.string());
+    }
+
+    [[noreturn]] static void close_and_throw(const int file, const std::filesystem::path& path)
+    {
+        const int error = errno;
+        ::close(file);
+        throw std::system_error(error, std::system_category(), path.string());
+    }
+#endif
+
+    const std::byte* m_data = nullptr;
+    std::size_t m_size = 0;
+};
+
+}  // namespace internal::mapped_file
+
+/**
+ * Column of strong types stored in a binary file, and loaded without copy by mapping the file in memory.
+ *
+ * The file records the kind and size of the underlying type, the byte order and the tag of S. Opening a file written
+ * for another strong type fails, even if it has the same underlying type: a column of UserId cannot be loaded as a
+ * column of OrderId. Since stronger::tag() hashes the location of the declaration, prefer stronger::tag("Name") for
+ * types of persisted columns, that does not change when the declaration moves.
+ *
+ * @tparam S Strong type of an integer or a floating point number, of 8 bytes or less
+ */
+template <concepts::mappable_strong_type S>
+class mapped_column
+{
+    using header = internal::mapped_file::header;
+
+public:
+
+    using value_type = S;
+    using size_type = std::size_t;
+    using const_iterator = std::span<const S>::iterator;
+
+    /**
+     * Maps the column stored in the file at `path`
+     *
+     * @throws std::system_error If the file cannot be opened or mapped
+     * @throws std::runtime_error If the file is not a column of S written on a machine of the same byte order
+     */
+    explicit mapped_column(const std::filesystem::path& path) :
+            m_file(path)
+    {
+        internal::check_span_cast_layout<S>();
+        const std::span<const std::byte> bytes = m_file.bytes();
+        if(bytes.size() < sizeof(header))
+            internal::mapped_file::throw_invalid_file(path, "file too small");
+        header found{};
+        std::memcpy(&found, bytes.data(), sizeof(header));
+        const header expected = internal::mapped_file::header_of<S>(0);
+        if(found.magic != expected.magic)
+            internal::mapped_file::throw_invalid_file(path, "unknown format");
+        // The byte order is checked first, since it is needed to read the other fields
+        if(found.order != expected.order)
+            internal::mapped_file::throw_invalid_file(path, "different byte order");
+        if(found.version != expected.version)
+            internal::mapped_file::throw_invalid_file(path, "unsupported version");
+        if(found.kind != expected.kind || found.value_size != expected.value_size)
+            internal::mapped_file::throw_invalid_file(path, "different underlying type");
+        if(found.tag != expected.tag)
+            internal::mapped_file::throw_invalid_file(path, "different strong type");
+        const size_type available = (bytes.size() - sizeof(header)) / sizeof(S);
+        if(found.count > available)
+            internal::mapped_file::throw_invalid_file(path, "truncated file");
+
+        const auto count = internal::cast<size_type>(found.count);
+        m_values = std::span<const S>(internal::reuse_storage<const S>(bytes.data() + sizeof(header), count), count);
+    }
+
+    /**
+     * Writes `values` to the file at `path`, replacing it
+     *
+     * @throws std::system_error If the file cannot be written
+     */
+    static void write(const std::filesystem::path& path, const std::span<const S> values)
+    {
+        internal::check_span_cast_layout<S>();
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        const header written = internal::mapped_file::header_of<S>(values.size());
+        file.write(reinterpret_cast<const char*>(&written), sizeof(header));
+        file.write(reinterpret_cast<const char*>(values.data()), internal::cast<std::streamsize>(values.size_bytes()));
+        file.close();
+        if(file.fail())
+            throw std::system_error(std::make_error_code(std::errc::io_error), path.string());
+    }
+
+    [[nodiscard]] std::span<const S> values() const noexcept { return m_values; }
+
+    [[nodiscard]] const S& operator[](const size_type position) const noexcept { return m_values[position]; }
+
+    [[nodiscard]] size_type size() const noexcept { return m_values.size(); }
+
+    [[nodiscard]] bool empty() const noexcept { return m_values.empty(); }
+
+    [[nodiscard]] const_iterator begin() const noexcept { return m_values.begin(); }
+
+    [[nodiscard]] const_iterator end() const noexcept { return m_values.end(); }
+
+private:
+
+    internal::mapped_file::file_view m_file;
+    std::span<const S> m_values;
+};
+
+}  // namespace stronger
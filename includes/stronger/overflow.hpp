@@ -0,0 +1,284 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+#include "strong_type.hpp"
+#include "traits/traits.hpp"
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+// Integer arithmetic of strong types with options::checked_arithmetic or options::saturating_arithmetic.
+// Every operation computes the wrapped result and whether the exact result fits in T, then either throws or saturates.
+// Opt-in, like the other headers of this directory: strong_type.hpp only declares these operations, so that it doesn't
+// depend on <stdexcept>.
+
+namespace stronger::internal::overflow
+{
+
+template <typename T>
+struct result
+{
+    T value;  // Wrapped around on overflow
+    bool overflowed;
+};
+
+template <supported T>
+[[nodiscard]] constexpr bool is_negative(const T value) noexcept
+{
+    if constexpr(std::is_signed_v<T>)
+        return value < 0;
+    else
+        return false;
+}
+
+/// Shift counts that are negative, or not less than the number of bits of T
+template <supported T>
+[[nodiscard]] constexpr bool is_invalid_shift(const T count) noexcept
+{
+    return is_negative(count) || count >= cast<T>(std::numeric_limits<std::make_unsigned_t<T>>::digits);
+}
+
+template <typename T>
+[[nodiscard]] constexpr T wrap_add(const T lhs, const T rhs) noexcept
+{
+    using unsigned_type = std::make_unsigned_t<T>;
+    return cast<T>(cast<unsigned_type>(cast<unsigned_type>(lhs) + cast<unsigned_type>(rhs)));
+}
+
+template <typename T>
+[[nodiscard]] constexpr T wrap_subtract(const T lhs, const T rhs) noexcept
+{
+    using unsigned_type = std::make_unsigned_t<T>;
+    return cast<T>(cast<unsigned_type>(cast<unsigned_type>(lhs) - cast<unsigned_type>(rhs)));
+}
+
+template <typename T>
+[[nodiscard]] constexpr T wrap_multiply(const T lhs, const T rhs) noexcept
+{
+    // Unsigned types smaller than int would be promoted to int, whose multiplication can overflow
+    using unsigned_type = std::common_type_t<std::make_unsigned_t<T>, unsigned int>;
+    return cast<T>(cast<unsigned_type>(cast<unsigned_type>(lhs) * cast<unsigned_type>(rhs)));
+}
+
+template <supported T>
+[[nodiscard]] constexpr result<T> add(const T lhs, const T rhs) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    T value{};
+    const bool overflowed = __builtin_add_overflow(lhs, rhs, &value);
+    return { value, overflowed };
+#else
+    const T value = wrap_add(lhs, rhs);
+    if constexpr(std::is_signed_v<T>)
+        return { value, ((lhs ^ value) & (rhs ^ value)) < 0 };
+    else
+        return { value, value < lhs };
+#endif
+}
+
+template <supported T>
+[[nodiscard]] constexpr result<T> subtract(const T lhs, const T rhs) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    T value{};
+    const bool overflowed = __builtin_sub_overflow(lhs, rhs, &value);
+    return { value, overflowed };
+#else
+    const T value = wrap_subtract(lhs, rhs);
+    if constexpr(std::is_signed_v<T>)
+        return { value, ((lhs ^ rhs) & (lhs ^ value)) < 0 };
+    else
+        return { value, lhs < rhs };
+#endif
+}
+
+template <supported T>
+[[nodiscard]] constexpr result<T> multiply(const T lhs, const T rhs) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    T value{};
+    const bool overflowed = __builtin_mul_overflow(lhs, rhs, &value);
+    return { value, overflowed };
+#else
+    constexpr T min = std::numeric_limits<T>::min();
+    constexpr T max = std::numeric_limits<T>::max();
+    const T value = wrap_multiply(lhs, rhs);
+    if constexpr(std::is_unsigned_v<T>)
+        return { value, rhs != 0 && lhs > max / rhs };
+    else if(lhs > 0)
+        return { value, rhs > 0 ? lhs > max / rhs : rhs < min / lhs };
+    else
+        return { value, rhs > 0 ? lhs < min / rhs : (lhs != 0 && rhs < max / lhs) };
+#endif
+}
+
+/// Only std::numeric_limits<T>::min() / -1 overflows. The divisor must not be 0
+template <supported T>
+[[nodiscard]] constexpr result<T> divide(const T lhs, const T rhs) noexcept
+{
+    if constexpr(std::is_signed_v<T>)
+    {
+        if(lhs == std::numeric_limits<T>::min() && rhs == -1)
+            return { lhs, true };
+    }
+    return { cast<T>(lhs / rhs), false };
+}
+
+/// Never overflows: std::numeric_limits<T>::min() % -1 is 0. The divisor must not be 0
+template <supported T>
+[[nodiscard]] constexpr result<T> remainder(const T lhs, const T rhs) noexcept
+{
+    if constexpr(std::is_signed_v<T>)
+    {
+        if(rhs == -1)
+            return { 0, false };
+    }
+    return { cast<T>(lhs % rhs), false };
+}
+
+/// Invalid shift counts overflow, unless the shifted value is 0
+template <supported T>
+[[nodiscard]] constexpr result<T> shift_left(const T lhs, const T rhs) noexcept
+{
+    if(is_invalid_shift(rhs))
+        return { 0, lhs != 0 };
+    using unsigned_type = std::common_type_t<std::make_unsigned_t<T>, unsigned int>;
+    const auto count = cast<unsigned int>(rhs);
+    const T value = cast<T>(cast<std::make_unsigned_t<T>>(cast<unsigned_type>(lhs) << count));
+    // Shifting back gives the original value only if no significant bit was lost
+    return { value, cast<T>(value >> count) != lhs };
+}
+
+template <supported T>
+[[nodiscard]] constexpr result<T> shift_right(const T lhs, const T rhs) noexcept
+{
+    if(is_invalid_shift(rhs))
+        return { cast<T>(is_negative(lhs) ? -1 : 0), true };
+    return { cast<T>(lhs >> rhs), false };
+}
+
+[[noreturn]] inline void throw_overflow()
+{
+    throw std::overflow_error("stronger: integer overflow");
+}
+
+/**
+ * Applies an operation of this namespace with the given mode
+ *
+ * @param operation One of the functions above, e.g. `add<T>`
+ * @param saturated Value to return on overflow, for mode::saturating
+ * @throws std::overflow_error With mode::checked, if the result does not fit in T
+ * @throws std::domain_error With mode::checked, on division or remainder by 0
+ */
+template <mode Mode, typename T, typename Operation>
+[[nodiscard]] constexpr T apply(const Operation operation, const T lhs, const T rhs, const T saturated)
+    noexcept(Mode == mode::saturating)
+{
+    const result<T> computed = operation(lhs, rhs);
+    if constexpr(Mode == mode::checked)
+    {
+        if(computed.overflowed)
+            throw_overflow();
+    }
+    return computed.overflowed ? saturated : computed.value;
+}
+
+template <mode Mode, supported T>
+constexpr void check_divisor(const T divisor)
+{
+    if constexpr(Mode == mode::checked)
+    {
+        if(divisor == 0)
+            throw std::domain_error("stronger: integer division by zero");
+    }
+}
+
+// Saturated values of each operation ..................................................................................
+
+template <supported T>
+[[nodiscard]] constexpr T saturated_sum(const T rhs) noexcept
+{
+    if constexpr(std::is_signed_v<T>)
+        return rhs < 0 ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+    else
+        return std::numeric_limits<T>::max();
+}
+
+template <supported T>
+[[nodiscard]] constexpr T saturated_difference(const T rhs) noexcept
+{
+    if constexpr(std::is_signed_v<T>)
+        return rhs < 0 ? std::numeric_limits<T>::max() : std::numeric_limits<T>::min();
+    else
+        return std::numeric_limits<T>::min();
+}
+
+template <supported T>
+[[nodiscard]] constexpr T saturated_product(const T lhs, const T rhs) noexcept
+{
+    if constexpr(std::is_signed_v<T>)
+        return (lhs < 0) != (rhs < 0) ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+    else
+        return std::numeric_limits<T>::max();
+}
+
+template <supported T>
+[[nodiscard]] constexpr T saturated_shift(const T lhs) noexcept
+{
+    if constexpr(std::is_signed_v<T>)
+        return lhs < 0 ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+    else
+        return lhs == 0 ? 0 : std::numeric_limits<T>::max();
+}
+
+// Operations ..........................................................................................................
+
+/// Operators of strong integers with options::checked_arithmetic or options::saturating_arithmetic
+template <mode Mode, supported T>
+struct arithmetic<Mode, T>
+{
+    static constexpr bool is_nothrow = Mode == mode::saturating;
+
+    [[nodiscard]] static constexpr T plus(const T lhs, const T rhs) noexcept(is_nothrow)
+    {
+        return apply<Mode>(add<T>, lhs, rhs, saturated_sum(rhs));
+    }
+
+    [[nodiscard]] static constexpr T minus(const T lhs, const T rhs) noexcept(is_nothrow)
+    {
+        return apply<Mode>(subtract<T>, lhs, rhs, saturated_difference(rhs));
+    }
+
+    [[nodiscard]] static constexpr T multiplies(const T lhs, const T rhs) noexcept(is_nothrow)
+    {
+        return apply<Mode>(multiply<T>, lhs, rhs, saturated_product(lhs, rhs));
+    }
+
+    [[nodiscard]] static constexpr T divides(const T lhs, const T rhs) noexcept(is_nothrow)
+    {
+        check_divisor<Mode>(rhs);
+        return apply<Mode>(divide<T>, lhs, rhs, std::numeric_limits<T>::max());
+    }
+
+    [[nodiscard]] static constexpr T modulus(const T lhs, const T rhs) noexcept(is_nothrow)
+    {
+        check_divisor<Mode>(rhs);
+        return remainder(lhs, rhs).value;
+    }
+
+    [[nodiscard]] static constexpr T left_shift(const T lhs, const T rhs) noexcept(is_nothrow)
+    {
+        return apply<Mode>(shift_left<T>, lhs, rhs, saturated_shift(lhs));
+    }
+
+    [[nodiscard]] static constexpr T right_shift(const T lhs, const T rhs) noexcept(is_nothrow)
+    {
+        // Shifting out every bit gives the sign
+        return apply<Mode>(shift_right<T>, lhs, rhs, cast<T>(is_negative(lhs) ? -1 : 0));
+    }
+};
+
+}  // namespace stronger::internal::overflow
@@ -0,0 +1,267 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+#include "strong_type.hpp"
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace stronger
+{
+
+template <typename T, size_t Tag, options... Options>
+class point_type;
+
+namespace traits
+{
+
+/// Underlying type of the difference between two points of underlying type T.
+/// Integers use the signed integer of the same size, so that going backwards gives a negative difference.
+template <typename T>
+struct point_difference
+{
+    using type = decltype(std::declval<T>() - std::declval<T>());
+};
+
+template <std::integral T>
+    requires(!std::same_as<T, bool>)
+struct point_difference<T>
+{
+    using type = std::make_signed_t<T>;
+};
+
+template <typename T>
+using point_difference_t = point_difference<T>::type;
+
+/// Gives access to the template arguments of a point_type
+template <typename T>
+struct point_type_info
+{
+    static constexpr bool is_point_type = false;
+};
+
+template <typename T, size_t Tag, options... Options>
+struct point_type_info<point_type<T, Tag, Options...>>
+{
+    static constexpr bool is_point_type = true;
+    using underlying_type = T;
+    using difference_type = point_type<T, Tag, Options...>::difference_type;
+    static constexpr size_t tag = Tag;
+};
+
+template <typename T>
+constexpr bool is_point_type = point_type_info<std::remove_cvref_t<T>>::is_point_type;
+
+}  // namespace traits
+
+/**
+ * Strong type of a position in an affine space: timestamps, file offsets, addresses, sequence numbers...
+ * Points can't be added together. Subtracting two points gives a difference_type, which is a strong_type with the
+ * same tag, and that can be added to or subtracted from points.
+ *
+ * With options::modular, integral points wrap around, and are compared by their signed difference (serial number
+ * arithmetic, RFC 1982): a < b when b is less than half the range ahead of a. Points exactly half the range apart are
+ * unordered, and this order is not transitive: modular points can't be sorted, nor used as keys of ordered containers.
+ *
+ * Points have the same layout as T, like strong types.
+ *
+ * @tparam T Arithmetic or pointer type
+ * @tparam Tag Shared with difference_type. You can use tag() to set this parameter
+ * @tparam Options options to enable. They apply to difference_type too
+ */
+template <typename T, size_t Tag, options... Options>
+class point_type
+{
+    using const_reference_like = std::conditional_t<traits::should_pass_by_value<T>, point_type, const point_type&>;
+    using reference = point_type&;
+    template <options Option>
+    constexpr static bool option_enabled = ((Option == Options) || ...);
+    using enum options;
+
+public:
+
+    using underlying_type = T;
+    using difference_type = strong_type<traits::point_difference_t<T>, Tag, Options...>;
+
+    static_assert(!option_enabled<modular> || std::unsigned_integral<T>,
+                  "stronger: options::modular requires an unsigned integral underlying type");
+
+private:
+
+    using difference_const_reference_like =
+        std::conditional_t<traits::should_pass_by_value<difference_type>, difference_type, const difference_type&>;
+
+    // Integer promotions may change the type of the results of operations on T: they are converted back
+    constexpr static bool is_subtractable = requires(const T& lhs, const T& rhs) { lhs - rhs; };
+    constexpr static bool is_translatable =
+        requires(const T& point, const traits::point_difference_t<T>& difference) {
+            point + difference;
+            point - difference;
+        };
+
+    // Integers are added and subtracted as unsigned values, so that they wrap around instead of overflowing
+    template <typename Result, typename Lhs, typename Rhs>
+    [[nodiscard]] static constexpr Result add(const Lhs lhs, const Rhs rhs) noexcept
+    {
+        using unsigned_type = std::make_unsigned_t<T>;
+        return internal::cast<Result>(
+            internal::cast<unsigned_type>(internal::cast<unsigned_type>(lhs) + internal::cast<unsigned_type>(rhs)));
+    }
+
+    template <typename Result, typename Lhs, typename Rhs>
+    [[nodiscard]] static constexpr Result subtract(const Lhs lhs, const Rhs rhs) noexcept
+    {
+        using unsigned_type = std::make_unsigned_t<T>;
+        return internal::cast<Result>(
+            internal::cast<unsigned_type>(internal::cast<unsigned_type>(lhs) - internal::cast<unsigned_type>(rhs)));
+    }
+
+public:
+
+    point_type()
+        requires concepts::supports_default_construction<T>
+    = default;
+
+    constexpr explicit(!option_enabled<allow_implicit_construction>) point_type(const T& value)
+        noexcept(std::is_nothrow_copy_constructible_v<T>) :
+            m_value{ value }
+    {
+    }
+
+    constexpr decltype(auto) operator*(this auto&& self) noexcept
+    {
+        return std::forward_like<decltype(self)>(self.m_value);
+    }
+
+    constexpr decltype(auto) operator->(this auto&& self) noexcept
+    {
+        if constexpr(std::is_pointer_v<underlying_type> || option_enabled<drill_down>)
+            return std::forward_like<decltype(self)>(self.m_value);
+        else
+            return __builtin_addressof(self.m_value);  // std::addressof, without including <memory>
+    }
+
+    // Affine arithmetic ...............................................................................................
+
+    [[nodiscard]] constexpr friend difference_type operator-(const_reference_like lhs, const_reference_like rhs)
+        noexcept(noexcept(lhs.m_value - rhs.m_value))
+        requires is_subtractable
+    {
+        using difference = traits::point_difference_t<T>;
+        if constexpr(std::integral<T>)
+            return difference_type{ subtract<difference>(lhs.m_value, rhs.m_value) };
+        else
+            return difference_type{ lhs.m_value - rhs.m_value };
+    }
+
+    [[nodiscard]] constexpr friend point_type operator+(const_reference_like lhs, difference_const_reference_like rhs)
+        noexcept(noexcept(lhs.m_value + *rhs))
+        requires is_translatable
+    {
+        if constexpr(std::integral<T>)
+            return point_type{ add<T>(lhs.m_value, *rhs) };
+        else
+            return point_type{ lhs.m_value + *rhs };
+    }
+
+    [[nodiscard]] constexpr friend point_type operator+(difference_const_reference_like lhs, const_reference_like rhs)
+        noexcept(noexcept(rhs + lhs))
+        requires is_translatable
+    {
+        return rhs + lhs;
+    }
+
+    [[nodiscard]] constexpr friend point_type operator-(const_reference_like lhs, difference_const_reference_like rhs)
+        noexcept(noexcept(lhs.m_value - *rhs))
+        requires is_translatable
+    {
+        if constexpr(std::integral<T>)
+            return point_type{ subtract<T>(lhs.m_value, *rhs) };
+        else
+            return point_type{ lhs.m_value - *rhs };
+    }
+
+    constexpr friend reference operator+=(reference lhs, difference_const_reference_like rhs)
+        noexcept(noexcept(lhs + rhs))
+        requires is_translatable
+    {
+        lhs = lhs + rhs;
+        return lhs;
+    }
+
+    constexpr friend reference operator-=(reference lhs, difference_const_reference_like rhs)
+        noexcept(noexcept(lhs - rhs))
+        requires is_translatable
+    {
+        lhs = lhs - rhs;
+        return lhs;
+    }
+
+    // Increment and decrement operators ...............................................................................
+
+    constexpr reference operator++() noexcept
+        requires std::integral<T>
+    {
+        m_value = add<T>(m_value, 1);
+        return *this;
+    }
+
+    constexpr reference operator--() noexcept
+        requires std::integral<T>
+    {
+        m_value = subtract<T>(m_value, 1);
+        return *this;
+    }
+
+    constexpr point_type operator++(int) noexcept
+        requires std::integral<T>
+    {
+        const point_type previous = *this;
+        ++*this;
+        return previous;
+    }
+
+    constexpr point_type operator--(int) noexcept
+        requires std::integral<T>
+    {
+        const point_type previous = *this;
+        --*this;
+        return previous;
+    }
+
+    // Comparison operators ............................................................................................
+
+    [[nodiscard]] constexpr friend bool operator==(const_reference_like lhs, const_reference_like rhs)
+        noexcept(noexcept(lhs.m_value == rhs.m_value))
+        requires concepts::supports_equal_to<T>
+    {
+        return lhs.m_value == rhs.m_value;
+    }
+
+    [[nodiscard]] constexpr friend auto operator<=>(const_reference_like lhs, const_reference_like rhs)
+        noexcept(noexcept(lhs.m_value <=> rhs.m_value))
+        requires concepts::supports_three_way_comparison<T>
+    {
+        if constexpr(option_enabled<modular>)
+        {
+            // Half the range ahead is also half the range behind
+            using difference = traits::point_difference_t<T>;
+            const difference distance = *(lhs - rhs);
+            if(distance == std::numeric_limits<difference>::min())
+                return std::partial_ordering::unordered;
+            return std::partial_ordering{ distance <=> difference{ 0 } };
+        }
+        else
+            return lhs.m_value <=> rhs.m_value;
+    }
+
+private:
+
+    T m_value;
+};
+
+}  // namespace stronger
@@ -0,0 +1,67 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+#include "strong_type.hpp"
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <version>
+
+#if defined(__cpp_lib_trivially_relocatable)
+#define STRONGER_CPP_BUILTIN_TRIVIALLY_RELOCATABLE(T) std::is_trivially_relocatable_v<T>
+#elif defined(__has_builtin)
+#if __has_builtin(__builtin_is_cpp_trivially_relocatable)
+#define STRONGER_CPP_BUILTIN_TRIVIALLY_RELOCATABLE(T) __builtin_is_cpp_trivially_relocatable(T)
+#elif __has_builtin(__is_trivially_relocatable)
+#define STRONGER_CPP_BUILTIN_TRIVIALLY_RELOCATABLE(T) __is_trivially_relocatable(T)
+#endif
+#endif
+#ifndef STRONGER_CPP_BUILTIN_TRIVIALLY_RELOCATABLE
+#define STRONGER_CPP_BUILTIN_TRIVIALLY_RELOCATABLE(T) false
+#endif
+
+namespace stronger
+{
+
+/**
+ * True if moving an object of type T to a new address and destroying the source can be done by copying its bytes, and
+ * forgetting the source. Containers use it to move their elements with std::memcpy when they grow or erase elements.
+ *
+ * Trivially copyable types are trivially relocatable, and so are the types the compiler reports as such. Specialize it
+ * to true for your types that do not store pointers to themselves, nor are pointed to by the objects they own.
+ * Strong types are trivially relocatable when their underlying type is.
+ */
+template <typename T>
+struct is_trivially_relocatable
+    : std::bool_constant<std::is_trivially_copyable_v<T> || STRONGER_CPP_BUILTIN_TRIVIALLY_RELOCATABLE(T)>
+{
+};
+
+#undef STRONGER_CPP_BUILTIN_TRIVIALLY_RELOCATABLE
+
+template <typename T>
+constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+template <typename T, size_t Tag, options... Options>
+struct is_trivially_relocatable<strong_type<T, Tag, Options...>> : is_trivially_relocatable<T>
+{
+};
+
+// Smart pointers of the standard libraries only hold pointers to the objects they own and to their control blocks
+template <typename T>
+struct is_trivially_relocatable<std::unique_ptr<T>> : std::true_type
+{
+};
+
+template <typename T>
+struct is_trivially_relocatable<std::shared_ptr<T>> : std::true_type
+{
+};
+
+template <typename T>
+struct is_trivially_relocatable<std::weak_ptr<T>> : std::true_type
+{
+};
+
+}  // namespace stronger
@@ -0,0 +1,305 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+#include "strong_type.hpp"
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+// Binary serialization of strong types, to a std::vector<std::byte>, in a chosen byte order.
+// Ranges are written as their size on 8 bytes, followed by their elements.
+
+namespace stronger
+{
+
+/**
+ * Customization point of stronger::serialize() and stronger::deserialize(). Specializations provide:
+ *
+ * @code
+ * template <std::endian Order> static void serialize(std::vector<std::byte>& out, const T& value);
+ * template <std::endian Order> static T deserialize(std::span<const std::byte>& in);
+ * @endcode
+ *
+ * serialize() appends the bytes of `value` to `out`. deserialize() reads a value from the front of `in`, removes its
+ * bytes from `in`, and throws std::out_of_range if `in` is too short.
+ */
+template <typename T>
+struct serializer
+{
+};
+
+namespace concepts
+{
+
+template <typename T, std::endian Order = std::endian::native>
+concept serializable = requires(std::vector<std::byte>& out, const T& value) {
+    serializer<T>::template serialize<Order>(out, value);
+};
+
+template <typename T, std::endian Order = std::endian::native>
+concept deserializable = requires(std::span<const std::byte>& in) {
+    { serializer<T>::template deserialize<Order>(in) } -> std::same_as<T>;
+};
+
+}  // namespace concepts
+
+/// Appends the bytes of `value` to `out`, in the byte order `Order`
+template <std::endian Order = std::endian::native, typename T>
+    requires concepts::serializable<T, Order>
+void serialize(std::vector<std::byte>& out, const T& value)
+{
+    serializer<T>::template serialize<Order>(out, value);
+}
+
+/**
+ * Reads a T written by serialize() with the same byte order from the front of `in`, and removes its bytes from `in`
+ *
+ * @throws std::out_of_range If `in` ends before the value
+ */
+template <typename T, std::endian Order = std::endian::native>
+    requires concepts::deserializable<T, Order>
+[[nodiscard]] T deserialize(std::span<const std::byte>& in)
+{
+    return serializer<T>::template deserialize<Order>(in);
+}
+
+namespace internal::serialization
+{
+
+/// Arithmetic type or enumeration that has the same object representation as T, or void if there is none.
+/// Arrays of types that have one are serialized with a single std::memcpy.
+template <typename T>
+struct bitwise_scalar
+{
+    using type = void;
+};
+
+template <typename T>
+    requires(std::is_arithmetic_v<T> && !std::same_as<T, bool>) || std::is_enum_v<T>
+struct bitwise_scalar<T>
+{
+    using type = T;
+};
+
+template <typename T, size_t Tag, options... Options>
+    requires std::is_standard_layout_v<strong_type<T, Tag, Options...>> &&
+             std::is_trivially_copyable_v<strong_type<T, Tag, Options...>> &&
+             (sizeof(strong_type<T, Tag, Options...>) == sizeof(T))
+struct bitwise_scalar<strong_type<T, Tag, Options...>>
+{
+    using type = bitwise_scalar<T>::type;
+};
+
+template <typename T>
+using bitwise_scalar_t = bitwise_scalar<T>::type;
+
+template <typename T>
+concept bitwise = !std::is_void_v<bitwise_scalar_t<T>>;
+
+template <size_t Size>
+using word = std::conditional_t<
+    Size == 2, uint16_t, std::conditional_t<Size == 4, uint32_t, std::conditional_t<Size == 8, uint64_t, void>>>;
+
+/// Reverses the bytes of `count` scalars stored at `bytes`. Compilers vectorize this loop
+template <typename Scalar>
+void swap_bytes(std::byte* const bytes, const size_t count) noexcept
+{
+    using word_type = word<sizeof(Scalar)>;
+    static_assert(!std::is_void_v<word_type>, "stronger: cannot change the byte order of this type");
+    for(size_t i = 0; i < count; ++i)
+    {
+        word_type value{};
+        std::memcpy(&value, bytes + i * sizeof(word_type), sizeof(word_type));
+        value = std::byteswap(value);
+        std::memcpy(bytes + i * sizeof(word_type), &value, sizeof(word_type));
+    }
+}
+
+template <std::endian Order, typename Scalar>
+constexpr bool needs_swap = Order != std::endian::native && sizeof(Scalar) > 1;
+
+[[noreturn]] inline void throw_truncated()
+{
+    throw std::out_of_range("stronger: not enough bytes to deserialize");
+}
+
+/// Removes the first `size` bytes from `in`, and returns them
+inline std::span<const std::byte> take(std::span<const std::byte>& in, const size_t size)
+{
+    if(in.size() < size)
+        throw_truncated();
+    const std::span<const std::byte> taken = in.first(size);
+    in = in.subspan(size);
+    return taken;
+}
+
+template <std::endian Order, bitwise T>
+void write_bitwise(std::vector<std::byte>& out, const T* const values, const size_t count)
+{
+    const size_t offset = out.size();
+    out.resize(offset + count * sizeof(T));
+    if(count == 0)
+        return;
+    std::memcpy(out.data() + offset, values, count * sizeof(T));
+    if constexpr(needs_swap<Order, bitwise_scalar_t<T>>)
+        swap_bytes<bitwise_scalar_t<T>>(out.data() + offset, count);
+}
+
+template <std::endian Order, bitwise T>
+void read_bitwise(std::span<const std::byte>& in, T* const values, const size_t count)
+{
+    if(count > in.size() / sizeof(T))
+        throw_truncated();
+    const std::span<const std::byte> bytes = take(in, count * sizeof(T));
+    if(count == 0)
+        return;
+    std::memcpy(values, bytes.data(), bytes.size());
+    if constexpr(needs_swap<Order, bitwise_scalar_t<T>>)
+        swap_bytes<bitwise_scalar_t<T>>(reinterpret_cast<std::byte*>(values), count);
+}
+
+template <typename R>
+concept serializable_range = std::ranges::sized_range<const R> && !traits::is_strong_type<R> && !bitwise<R> &&
+                             concepts::serializable<std::ranges::range_value_t<R>>;
+
+/// Ranges that deserialize() can fill, like std::vector or std::string
+template <typename R>
+concept deserializable_range = serializable_range<R> && std::default_initializable<R> &&
+                               std::ranges::output_range<R&, std::ranges::range_value_t<R>> &&
+                               concepts::deserializable<std::ranges::range_value_t<R>> &&
+                               requires(R& range, size_t size) { range.resize(size); };
+
+template <typename T>
+concept trivially_serializable = std::is_trivially_copyable_v<T> && std::default_initializable<T> &&
+                                 !std::same_as<T, bool> && !std::is_pointer_v<T> && !std::is_member_pointer_v<T> &&
+                                 !traits::is_strong_type<T> && !bitwise<T> && !std::ranges::range<T>;
+
+}  // namespace internal::serialization
+
+/// Arithmetic types, enumerations and strong types of them are copied, and their bytes are reversed if needed
+template <internal::serialization::bitwise T>
+struct serializer<T>
+{
+    template <std::endian Order>
+    static void serialize(std::vector<std::byte>& out, const T& value)
+    {
+        internal::serialization::write_bitwise<Order>(out, &value, 1);
+    }
+
+    template <std::endian Order>
+    static T deserialize(std::span<const std::byte>& in)
+    {
+        T value{};
+        internal::serialization::read_bitwise<Order>(in, &value, 1);
+        return value;
+    }
+};
+
+template <>
+struct serializer<bool>
+{
+    template <std::endian Order>
+    static void serialize(std::vector<std::byte>& out, const bool value)
+    {
+        out.push_back(value ? std::byte{ 1 } : std::byte{ 0 });
+    }
+
+    template <std::endian Order>
+    static bool deserialize(std::span<const std::byte>& in)
+    {
+        return internal::serialization::take(in, 1)[0] != std::byte{ 0 };
+    }
+};
+
+/// Other strong types are serialized as their underlying type
+template <typename T, size_t Tag, options... Options>
+    requires(!internal::serialization::bitwise<strong_type<T, Tag, Options...>>) && concepts::serializable<T>
+struct serializer<strong_type<T, Tag, Options...>>
+{
+    using strong = strong_type<T, Tag, Options...>;
+
+    template <std::endian Order>
+        requires concepts::serializable<T, Order>
+    static void serialize(std::vector<std::byte>& out, const strong& value)
+    {
+        serializer<T>::template serialize<Order>(out, *value);
+    }
+
+    template <std::endian Order>
+    static strong deserialize(std::span<const std::byte>& in)
+        requires concepts::deserializable<T, Order>
+    {
+        return strong{ serializer<T>::template deserialize<Order>(in) };
+    }
+};
+
+/// Sized ranges are serialized as their size followed by their elements. Contiguous ranges of arithmetic types and of
+/// strong types of them are copied with a single std::memcpy.
+template <internal::serialization::serializable_range R>
+struct serializer<R>
+{
+    using value_type = std::ranges::range_value_t<R>;
+
+    template <std::endian Order>
+        requires concepts::serializable<value_type, Order>
+    static void serialize(std::vector<std::byte>& out, const R& range)
+    {
+        const auto size = internal::cast<uint64_t>(std::ranges::size(range));
+        serializer<uint64_t>::serialize<Order>(out, size);
+        if constexpr(std::ranges::contiguous_range<const R> && internal::serialization::bitwise<value_type>)
+            internal::serialization::write_bitwise<Order>(out, std::ranges::data(range), std::ranges::size(range));
+        else
+            for(const auto& element : range)
+                serializer<value_type>::template serialize<Order>(out, element);
+    }
+
+    template <std::endian Order>
+    static R deserialize(std::span<const std::byte>& in)
+        requires internal::serialization::deserializable_range<R> && concepts::deserializable<value_type, Order>
+    {
+        const uint64_t size = serializer<uint64_t>::deserialize<Order>(in);
+        // Every element takes at least one byte: this rejects sizes of corrupted data before allocating
+        if(size > in.size())
+            internal::serialization::throw_truncated();
+        R range;
+        range.resize(internal::cast<size_t>(size));
+        if constexpr(std::ranges::contiguous_range<R> && internal::serialization::bitwise<value_type>)
+            internal::serialization::read_bitwise<Order>(in, std::ranges::data(range), std::ranges::size(range));
+        else
+            for(auto& element : range)
+                element = serializer<value_type>::template deserialize<Order>(in);
+        return range;
+    }
+};
+
+/// Other trivially copyable types are copied as they are, so they can only be serialized in the native byte order
+template <internal::serialization::trivially_serializable T>
+struct serializer<T>
+{
+    template <std::endian Order>
+        requires(Order == std::endian::native)
+    static void serialize(std::vector<std::byte>& out, const T& value)
+    {
+        const auto* const bytes = reinterpret_cast<const std::byte*>(&value);
+        out.insert(out.end(), bytes, bytes + sizeof(T));
+    }
+
+    template <std::endian Order>
+        requires(Order == std::endian::native)
+    static T deserialize(std::span<const std::byte>& in)
+    {
+        T value{};
+        std::memcpy(&value, internal::serialization::take(in, sizeof(T)).data(), sizeof(T));
+        return value;
+    }
+};
+
+}  // namespace stronger
@@ -0,0 +1,168 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+#include "strong_type.hpp"
+
+#if __has_include(<experimental/simd>)
+#include <concepts>
+#include <cstddef>
+#include <experimental/simd>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+namespace stronger
+{
+
+namespace traits
+{
+
+/// Gives access to the scalar strong type and the mask type of a strong type of std::experimental::simd
+template <typename T>
+struct simd_info
+{
+    static constexpr bool is_strong_simd = false;
+};
+
+template <typename T, typename Abi, size_t Tag, options... Options>
+struct simd_info<strong_type<std::experimental::simd<T, Abi>, Tag, Options...>>
+{
+    static constexpr bool is_strong_simd = true;
+    using scalar_type = strong_type<T, Tag, Options...>;
+    using mask_type = std::experimental::simd<T, Abi>::mask_type;
+};
+
+}  // namespace traits
+
+namespace concepts
+{
+
+/// Strong type of std::experimental::simd
+template <typename Batch>
+concept strong_simd = traits::simd_info<std::remove_cvref_t<Batch>>::is_strong_simd;
+
+/// Strong type of an arithmetic type, that can be packed in a std::experimental::simd
+template <typename Scalar>
+concept strong_simd_scalar =
+    traits::is_strong_type<Scalar> && std::is_arithmetic_v<typename Scalar::underlying_type> &&
+    !std::same_as<std::remove_cv_t<typename Scalar::underlying_type>, bool> &&
+    sizeof(Scalar) == sizeof(typename Scalar::underlying_type) && std::is_standard_layout_v<Scalar>;
+
+}  // namespace concepts
+
+namespace internal
+{
+
+template <typename Scalar>
+struct simd_of_impl;
+
+template <typename T, size_t Tag, options... Options>
+struct simd_of_impl<strong_type<T, Tag, Options...>>
+{
+    using type = strong_type<std::experimental::native_simd<T>, Tag, Options...>;
+};
+
+/// Result of where(mask, batch): assigns to the elements of the batch selected by the mask
+template <typename Batch>
+class simd_where_expression
+{
+    using mask_type = traits::simd_info<Batch>::mask_type;
+
+public:
+
+    constexpr simd_where_expression(const mask_type& mask, Batch& batch) noexcept :
+            m_mask(mask),
+            m_batch(std::addressof(batch))
+    {
+    }
+
+    constexpr void operator=(const Batch& value) && noexcept { std::experimental::where(m_mask, **m_batch) = *value; }
+
+    constexpr void operator+=(const Batch& value) && noexcept { std::experimental::where(m_mask, **m_batch) += *value; }
+
+    constexpr void operator-=(const Batch& value) && noexcept { std::experimental::where(m_mask, **m_batch) -= *value; }
+
+    constexpr void operator*=(const Batch& value) && noexcept { std::experimental::where(m_mask, **m_batch) *= *value; }
+
+    constexpr void operator/=(const Batch& value) && noexcept { std::experimental::where(m_mask, **m_batch) /= *value; }
+
+private:
+
+    mask_type m_mask;
+    Batch* m_batch;
+};
+
+}  // namespace internal
+
+/**
+ * Batch of scalar strong types, processed with SIMD instructions.
+ * It has the same tag and options as Scalar, so batches of different strong types can't be mixed either.
+ *
+ * Operators are the ones of std::experimental::native_simd. Comparisons return masks of the underlying simd type.
+ *
+ * @tparam Scalar Strong type of an arithmetic type
+ */
+template <concepts::strong_simd_scalar Scalar>
+using simd_of = internal::simd_of_impl<Scalar>::type;
+
+/**
+ * Loads the first simd_of<Scalar>::size() elements of `scalars` into a batch.
+ * `scalars` must contain at least simd_of<Scalar>::size() elements.
+ */
+template <concepts::strong_simd_scalar Scalar, size_t Extent>
+[[nodiscard]] simd_of<std::remove_const_t<Scalar>> load_simd(const std::span<Scalar, Extent> scalars) noexcept
+{
+    using underlying_type = std::remove_const_t<Scalar>::underlying_type;
+    // Scalar is standard layout, with the same size as its only member: it is pointer-interconvertible with it
+    const auto* const data = reinterpret_cast<const underlying_type*>(scalars.data());
+    return simd_of<std::remove_const_t<Scalar>>{
+        std::experimental::native_simd<underlying_type>{ data, std::experimental::element_aligned }
+    };
+}
+
+/**
+ * Stores the elements of `batch` into the first simd_of<Scalar>::size() elements of `scalars`.
+ * `scalars` must contain at least simd_of<Scalar>::size() elements.
+ */
+template <concepts::strong_simd_scalar Scalar, size_t Extent>
+    requires(!std::is_const_v<Scalar>)
+void store_simd(const simd_of<Scalar>& batch, const std::span<Scalar, Extent> scalars) noexcept
+{
+    using underlying_type = Scalar::underlying_type;
+    auto* const data = reinterpret_cast<underlying_type*>(scalars.data());
+    batch->copy_to(data, std::experimental::element_aligned);
+}
+
+/// Selects the elements of `batch` that are assigned by the returned expression, like std::experimental::where
+template <concepts::strong_simd Batch>
+[[nodiscard]] constexpr internal::simd_where_expression<Batch>
+    where(const typename traits::simd_info<Batch>::mask_type& mask, Batch& batch) noexcept
+{
+    return { mask, batch };
+}
+
+/// Sum of the elements of `batch`
+template <concepts::strong_simd Batch>
+[[nodiscard]] constexpr typename traits::simd_info<Batch>::scalar_type reduce(const Batch& batch) noexcept
+{
+    return typename traits::simd_info<Batch>::scalar_type{ std::experimental::reduce(*batch) };
+}
+
+/// Minimum of the elements of `batch`
+template <concepts::strong_simd Batch>
+[[nodiscard]] constexpr typename traits::simd_info<Batch>::scalar_type hmin(const Batch& batch) noexcept
+{
+    return typename traits::simd_info<Batch>::scalar_type{ std::experimental::hmin(*batch) };
+}
+
+/// Maximum of the elements of `batch`
+template <concepts::strong_simd Batch>
+[[nodiscard]] constexpr typename traits::simd_info<Batch>::scalar_type hmax(const Batch& batch) noexcept
+{
+    return typename traits::simd_info<Batch>::scalar_type{ std::experimental::hmax(*batch) };
+}
+
+}  // namespace stronger
+
+#endif
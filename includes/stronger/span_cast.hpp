@@ -0,0 +1,91 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+#include "strong_type.hpp"
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <version>
+
+namespace stronger
+{
+
+namespace internal
+{
+
+template <typename From, typename To>
+using copy_const_t = std::conditional_t<std::is_const_v<From>, const To, To>;
+
+/// Checks that arrays of S have the same object representation as arrays of its underlying type
+template <typename S>
+constexpr void check_span_cast_layout() noexcept
+{
+    using underlying_type = S::underlying_type;
+    static_assert(std::is_standard_layout_v<S>, "stronger: span casts require a standard layout strong type");
+    static_assert(sizeof(S) == sizeof(underlying_type),
+                  "stronger: span casts require a strong type of the same size as its underlying type");
+    static_assert(alignof(S) == alignof(underlying_type),
+                  "stronger: span casts require a strong type of the same alignment as its underlying type");
+    static_assert(std::is_trivially_copyable_v<S> && std::is_trivially_copyable_v<underlying_type>,
+                  "stronger: span casts require trivially copyable types");
+}
+
+/// Ends the lifetime of the `count` objects at `data`, and starts the lifetime of `count` objects of type To in their
+/// storage, with the same values
+template <typename To, typename From>
+[[nodiscard]] To* reuse_storage(From* const data, const std::size_t count) noexcept
+{
+#ifdef __cpp_lib_start_lifetime_as
+    return std::start_lifetime_as_array<std::remove_const_t<To>>(data, count);
+#else
+    // Both types are pointer-interconvertible: this is how implementations without std::start_lifetime_as_array
+    // support it
+    static_cast<void>(count);
+    return std::launder(reinterpret_cast<To*>(data));
+#endif
+}
+
+}  // namespace internal
+
+/**
+ * Views contiguous values of S's underlying type as strong types, without copying them, e.g. a buffer of doubles read
+ * from a file as a span of Amount. The constness and the extent of `values` are kept.
+ *
+ * The elements become strong types: access them through the returned span only, until as_underlying_span() gives
+ * back a span of the underlying type.
+ *
+ * @tparam S Strong type of standard layout, with the same size and alignment as its underlying type
+ */
+template <typename S, typename T, std::size_t Extent>
+    requires traits::is_strong_type<S> && std::same_as<std::remove_const_t<T>, typename S::underlying_type>
+[[nodiscard]] std::span<internal::copy_const_t<T, S>, Extent> as_strong_span(const std::span<T, Extent> values) noexcept
+{
+    internal::check_span_cast_layout<S>();
+    using element_type = internal::copy_const_t<T, S>;
+    return std::span<element_type, Extent>(internal::reuse_storage<element_type>(values.data(), values.size()),
+                                           values.size());
+}
+
+/**
+ * Views contiguous strong types as values of their underlying type, without copying them, e.g. to write them to a
+ * file or a network buffer. The constness and the extent of `values` are kept.
+ *
+ * The elements stop being strong types: access them through the returned span only, until as_strong_span() gives
+ * back a span of strong types.
+ */
+template <typename S, std::size_t Extent>
+    requires traits::is_strong_type<S>
+[[nodiscard]] std::span<internal::copy_const_t<S, typename std::remove_const_t<S>::underlying_type>, Extent>
+    as_underlying_span(const std::span<S, Extent> values) noexcept
+{
+    internal::check_span_cast_layout<std::remove_const_t<S>>();
+    using element_type = internal::copy_const_t<S, typename std::remove_const_t<S>::underlying_type>;
+    return std::span<element_type, Extent>(internal::reuse_storage<element_type>(values.data(), values.size()),
+                                           values.size());
+}
+
+}  // namespace stronger
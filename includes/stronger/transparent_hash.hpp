@@ -0,0 +1,90 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+#include "strong_type.hpp"
+#include <concepts>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace stronger
+{
+
+namespace traits
+{
+
+/**
+ * Tells whether View values can stand for Owner values in heterogeneous lookups.
+ * A view must compare equal to, and hash like, the owner values it refers to.
+ *
+ * Specialize it to allow other views of your own types.
+ */
+template <typename View, typename Owner>
+constexpr bool is_borrowed_view_of = false;
+
+template <typename CharT, typename Traits, typename Allocator>
+constexpr bool
+    is_borrowed_view_of<std::basic_string_view<CharT, Traits>, std::basic_string<CharT, Traits, Allocator>> = true;
+
+}  // namespace traits
+
+namespace concepts
+{
+
+/// View is a strong type with the same tag as StrongType, whose underlying type is a view of StrongType's one
+template <typename View, typename StrongType>
+concept borrowed_view_of =
+    traits::is_strong_type<View> && traits::is_strong_type<StrongType> &&
+    traits::strong_type_info<View>::tag == traits::strong_type_info<StrongType>::tag &&
+    traits::is_borrowed_view_of<typename traits::strong_type_info<View>::underlying_type,
+                                typename traits::strong_type_info<StrongType>::underlying_type>;
+
+/// Key types accepted by transparent_hash<StrongType> and transparent_equal_to<StrongType>
+template <typename Key, typename StrongType>
+concept transparent_key_of = std::same_as<Key, StrongType> || borrowed_view_of<Key, StrongType>;
+
+}  // namespace concepts
+
+/**
+ * Hash function enabling heterogeneous lookups in unordered containers of strong types.
+ * Besides StrongType, it accepts strong types with the same tag whose underlying type is a borrowed view of
+ * StrongType's underlying type (e.g. strong_type<std::string_view, Tag> for strong_type<std::string, Tag>).
+ * Lookups with a view never construct a StrongType.
+ *
+ * @tparam StrongType Key type of the container
+ */
+template <typename StrongType>
+    requires traits::is_strong_type<StrongType>
+struct transparent_hash
+{
+    using is_transparent = void;
+
+    template <concepts::transparent_key_of<StrongType> Key>
+    [[nodiscard]] static constexpr size_t operator()(const Key& key)
+        noexcept(noexcept(std::hash<typename Key::underlying_type>{}(*key)))
+    {
+        return std::hash<typename Key::underlying_type>{}(*key);
+    }
+};
+
+/**
+ * Equality comparison enabling heterogeneous lookups in unordered containers of strong types.
+ * Accepts the same key types as transparent_hash<StrongType>.
+ *
+ * @tparam StrongType Key type of the container
+ */
+template <typename StrongType>
+    requires traits::is_strong_type<StrongType>
+struct transparent_equal_to
+{
+    using is_transparent = void;
+
+    template <concepts::transparent_key_of<StrongType> Lhs, concepts::transparent_key_of<StrongType> Rhs>
+    [[nodiscard]] static constexpr bool operator()(const Lhs& lhs, const Rhs& rhs) noexcept(noexcept(*lhs == *rhs))
+    {
+        return *lhs == *rhs;
+    }
+};
+
+}  // namespace stronger
@@ -0,0 +1,347 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+#include "traits/traits.hpp"
+#include <cmath>
+#include <compare>
+#include <concepts>
+#include <numeric>
+#include <ratio>
+#include <type_traits>
+#include <utility>
+
+namespace stronger::units
+{
+
+/**
+ * Exponents of the SI base dimensions of a unit.
+ * For example, a speed is a length divided by a time: dimension<1, 0, -1>.
+ */
+template <int Length = 0, int Mass = 0, int Time = 0, int Current = 0, int Temperature = 0, int Amount = 0,
+          int Luminosity = 0>
+struct dimension
+{
+};
+
+/**
+ * Unit of measurement, as a scaling of the coherent SI unit of its dimension.
+ * For example, a kilometer is unit<dimension<1>, std::kilo>.
+ *
+ * @tparam Dimension Instance of dimension
+ * @tparam Ratio Value of the unit, in coherent SI units
+ */
+template <typename Dimension, typename Ratio = std::ratio<1>>
+struct unit
+{
+    using dimension_type = Dimension;
+    using ratio_type = Ratio::type;
+};
+
+namespace internal
+{
+
+template <typename Lhs, typename Rhs>
+struct dimension_product;
+
+template <int... Lhs, int... Rhs>
+struct dimension_product<dimension<Lhs...>, dimension<Rhs...>>
+{
+    using type = dimension<(Lhs + Rhs)...>;
+};
+
+template <typename Lhs, typename Rhs>
+struct dimension_quotient;
+
+template <int... Lhs, int... Rhs>
+struct dimension_quotient<dimension<Lhs...>, dimension<Rhs...>>
+{
+    using type = dimension<(Lhs - Rhs)...>;
+};
+
+template <typename Dimension>
+struct dimension_root;
+
+template <int... Exponents>
+struct dimension_root<dimension<Exponents...>>
+{
+    static constexpr bool is_exact = ((Exponents % 2 == 0) && ...);
+    using type = dimension<(Exponents / 2)...>;
+};
+
+/// Factor to apply to values in From units to get values in To units
+template <typename From, typename To>
+using conversion_factor = std::ratio_divide<typename From::ratio_type, typename To::ratio_type>::type;
+
+/// Converting from From to To never loses precision
+template <typename Rep, typename From, typename To>
+concept lossless_conversion = std::floating_point<Rep> || conversion_factor<From, To>::den == 1;
+
+using stronger::internal::cast;
+
+/// Multiplies `value` by Factor. The factor is a compile-time constant, and nothing is done when it is 1.
+template <typename Rep, typename Factor>
+[[nodiscard]] constexpr Rep scale(const Rep value) noexcept
+{
+    if constexpr(Factor::num == 1 && Factor::den == 1)
+        return value;
+    else if constexpr(std::floating_point<Rep>)
+        return value * (cast<Rep>(Factor::num) / cast<Rep>(Factor::den));
+    else if constexpr(Factor::den == 1)
+        return cast<Rep>(value * cast<Rep>(Factor::num));
+    else
+        return cast<Rep>(value * cast<Rep>(Factor::num) / cast<Rep>(Factor::den));
+}
+
+}  // namespace internal
+
+/// Unit of the product of two quantities
+template <typename Lhs, typename Rhs>
+using unit_product = unit<typename internal::dimension_product<typename Lhs::dimension_type,
+                                                               typename Rhs::dimension_type>::type,
+                          std::ratio_multiply<typename Lhs::ratio_type, typename Rhs::ratio_type>>;
+
+/// Unit of the quotient of two quantities
+template <typename Lhs, typename Rhs>
+using unit_quotient = unit<typename internal::dimension_quotient<typename Lhs::dimension_type,
+                                                                 typename Rhs::dimension_type>::type,
+                           std::ratio_divide<typename Lhs::ratio_type, typename Rhs::ratio_type>>;
+
+/// Finest unit both Lhs and Rhs convert to without loss, like std::common_type of std::chrono::duration
+template <typename Lhs, typename Rhs>
+using common_unit = std::conditional_t<
+    std::is_same_v<Lhs, Rhs>, Lhs,
+    unit<typename Lhs::dimension_type,
+         std::ratio<std::gcd(Lhs::ratio_type::num, Rhs::ratio_type::num),
+                    std::lcm(Lhs::ratio_type::den, Rhs::ratio_type::den)>>>;
+
+namespace concepts
+{
+
+template <typename Lhs, typename Rhs>
+concept same_dimension = std::same_as<typename Lhs::dimension_type, typename Rhs::dimension_type>;
+
+}  // namespace concepts
+
+/**
+ * Value of an arithmetic type in a given unit.
+ *
+ * Quantities of the same dimension can be added, subtracted and compared, and convert implicitly to each other when
+ * no precision is lost. Quantities of any dimensions can be multiplied and divided, and result in a quantity of the
+ * product or quotient unit.
+ * All the unit computations and conversion factors are resolved at compile time: operations on quantities of the
+ * same unit compile to the same code as the operations on their values.
+ *
+ * @tparam Rep Arithmetic type of the value
+ * @tparam Unit Instance of unit
+ */
+template <typename Rep, typename Unit>
+    requires std::is_arithmetic_v<Rep>
+class quantity
+{
+public:
+
+    using rep = Rep;
+    using unit_type = Unit;
+
+    quantity() = default;
+
+    constexpr explicit quantity(const Rep value) noexcept :
+            m_value(value)
+    {
+    }
+
+    /// Converts from quantities of the same dimension, when no precision can be lost
+    template <typename OtherUnit>
+        requires concepts::same_dimension<OtherUnit, Unit> && (!std::same_as<OtherUnit, Unit>) &&
+                 internal::lossless_conversion<Rep, OtherUnit, Unit>
+    constexpr quantity(const quantity<Rep, OtherUnit>& other) noexcept :
+            m_value(internal::scale<Rep, internal::conversion_factor<OtherUnit, Unit>>(*other))
+    {
+    }
+
+    constexpr decltype(auto) operator*(this auto&& self) noexcept
+    {
+        return std::forward_like<decltype(self)>(self.m_value);
+    }
+
+    [[nodiscard]] constexpr quantity operator+() const noexcept { return *this; }
+
+    [[nodiscard]] constexpr quantity operator-() const noexcept { return quantity{ internal::cast<Rep>(-m_value) }; }
+
+    constexpr quantity& operator+=(const quantity& rhs) noexcept
+    {
+        m_value += rhs.m_value;
+        return *this;
+    }
+
+    constexpr quantity& operator-=(const quantity& rhs) noexcept
+    {
+        m_value -= rhs.m_value;
+        return *this;
+    }
+
+    constexpr quantity& operator*=(const Rep rhs) noexcept
+    {
+        m_value *= rhs;
+        return *this;
+    }
+
+    constexpr quantity& operator/=(const Rep rhs) noexcept
+    {
+        m_value /= rhs;
+        return *this;
+    }
+
+private:
+
+    Rep m_value;
+};
+
+/// Converts `value` to the quantity To of the same dimension, even if precision is lost
+template <typename To, typename Rep, typename Unit>
+    requires std::same_as<typename To::rep, Rep> && concepts::same_dimension<typename To::unit_type, Unit>
+[[nodiscard]] constexpr To quantity_cast(const quantity<Rep, Unit>& value) noexcept
+{
+    return To{ internal::scale<Rep, internal::conversion_factor<Unit, typename To::unit_type>>(*value) };
+}
+
+// Operators between quantities of the same dimension _________________________________________________________________
+
+template <typename Rep, typename Lhs, typename Rhs>
+    requires concepts::same_dimension<Lhs, Rhs>
+[[nodiscard]] constexpr quantity<Rep, common_unit<Lhs, Rhs>> operator+(const quantity<Rep, Lhs>& lhs,
+                                                                       const quantity<Rep, Rhs>& rhs) noexcept
+{
+    using result = quantity<Rep, common_unit<Lhs, Rhs>>;
+    return result{ internal::cast<Rep>(*result{ lhs } + *result{ rhs }) };
+}
+
+template <typename Rep, typename Lhs, typename Rhs>
+    requires concepts::same_dimension<Lhs, Rhs>
+[[nodiscard]] constexpr quantity<Rep, common_unit<Lhs, Rhs>> operator-(const quantity<Rep, Lhs>& lhs,
+                                                                       const quantity<Rep, Rhs>& rhs) noexcept
+{
+    using result = quantity<Rep, common_unit<Lhs, Rhs>>;
+    return result{ internal::cast<Rep>(*result{ lhs } - *result{ rhs }) };
+}
+
+template <typename Rep, typename Lhs, typename Rhs>
+    requires concepts::same_dimension<Lhs, Rhs>
+[[nodiscard]] constexpr bool operator==(const quantity<Rep, Lhs>& lhs, const quantity<Rep, Rhs>& rhs) noexcept
+{
+    using common = quantity<Rep, common_unit<Lhs, Rhs>>;
+    return *common{ lhs } == *common{ rhs };
+}
+
+template <typename Rep, typename Lhs, typename Rhs>
+    requires concepts::same_dimension<Lhs, Rhs>
+[[nodiscard]] constexpr auto operator<=>(const quantity<Rep, Lhs>& lhs, const quantity<Rep, Rhs>& rhs) noexcept
+{
+    using common = quantity<Rep, common_unit<Lhs, Rhs>>;
+    return *common{ lhs } <=> *common{ rhs };
+}
+
+// Operators between quantities of any dimensions _____________________________________________________________________
+
+template <typename Rep, typename Lhs, typename Rhs>
+[[nodiscard]] constexpr quantity<Rep, unit_product<Lhs, Rhs>> operator*(const quantity<Rep, Lhs>& lhs,
+                                                                        const quantity<Rep, Rhs>& rhs) noexcept
+{
+    return quantity<Rep, unit_product<Lhs, Rhs>>{ internal::cast<Rep>(*lhs * *rhs) };
+}
+
+template <typename Rep, typename Lhs, typename Rhs>
+[[nodiscard]] constexpr quantity<Rep, unit_quotient<Lhs, Rhs>> operator/(const quantity<Rep, Lhs>& lhs,
+                                                                         const quantity<Rep, Rhs>& rhs) noexcept
+{
+    return quantity<Rep, unit_quotient<Lhs, Rhs>>{ internal::cast<Rep>(*lhs / *rhs) };
+}
+
+// Operators with dimensionless scalars ________________________________________________________________________________
+
+template <typename Rep, typename Unit>
+[[nodiscard]] constexpr quantity<Rep, Unit> operator*(const quantity<Rep, Unit>& lhs,
+                                                      const std::type_identity_t<Rep> rhs) noexcept
+{
+    return quantity<Rep, Unit>{ internal::cast<Rep>(*lhs * rhs) };
+}
+
+template <typename Rep, typename Unit>
+[[nodiscard]] constexpr quantity<Rep, Unit> operator*(const std::type_identity_t<Rep> lhs,
+                                                      const quantity<Rep, Unit>& rhs) noexcept
+{
+    return quantity<Rep, Unit>{ internal::cast<Rep>(lhs * *rhs) };
+}
+
+template <typename Rep, typename Unit>
+[[nodiscard]] constexpr quantity<Rep, Unit> operator/(const quantity<Rep, Unit>& lhs,
+                                                      const std::type_identity_t<Rep> rhs) noexcept
+{
+    return quantity<Rep, Unit>{ internal::cast<Rep>(*lhs / rhs) };
+}
+
+template <typename Rep, typename Unit>
+[[nodiscard]] constexpr quantity<Rep, unit_quotient<unit<dimension<>>, Unit>>
+    operator/(const std::type_identity_t<Rep> lhs, const quantity<Rep, Unit>& rhs) noexcept
+{
+    return quantity<Rep, unit_quotient<unit<dimension<>>, Unit>>{ internal::cast<Rep>(lhs / *rhs) };
+}
+
+/// Square root of a quantity whose dimension exponents are all even, in a coherent SI unit
+template <std::floating_point Rep, typename Unit>
+    requires internal::dimension_root<typename Unit::dimension_type>::is_exact &&
+             std::ratio_equal_v<typename Unit::ratio_type, std::ratio<1>>
+[[nodiscard]] quantity<Rep, unit<typename internal::dimension_root<typename Unit::dimension_type>::type>>
+    sqrt(const quantity<Rep, Unit>& value) noexcept
+{
+    using result = quantity<Rep, unit<typename internal::dimension_root<typename Unit::dimension_type>::type>>;
+    return result{ std::sqrt(*value) };
+}
+
+// Common units ________________________________________________________________________________________________________
+
+using one = unit<dimension<>>;
+
+using meter = unit<dimension<1>>;
+using kilometer = unit<dimension<1>, std::kilo>;
+using millimeter = unit<dimension<1>, std::milli>;
+using kilogram = unit<dimension<0, 1>>;
+using gram = unit<dimension<0, 1>, std::milli>;
+using second = unit<dimension<0, 0, 1>>;
+using millisecond = unit<dimension<0, 0, 1>, std::milli>;
+using minute = unit<dimension<0, 0, 1>, std::ratio<60>>;
+using hour = unit<dimension<0, 0, 1>, std::ratio<3600>>;
+using ampere = unit<dimension<0, 0, 0, 1>>;
+using kelvin = unit<dimension<0, 0, 0, 0, 1>>;
+using mole = unit<dimension<0, 0, 0, 0, 0, 1>>;
+using candela = unit<dimension<0, 0, 0, 0, 0, 0, 1>>;
+
+using square_meter = unit_product<meter, meter>;
+using cubic_meter = unit_product<square_meter, meter>;
+using meter_per_second = unit_quotient<meter, second>;
+using meter_per_second_squared = unit_quotient<meter_per_second, second>;
+using kilometer_per_hour = unit_quotient<kilometer, hour>;
+using newton = unit_product<kilogram, meter_per_second_squared>;
+using joule = unit_product<newton, meter>;
+using watt = unit_quotient<joule, second>;
+
+using meters = quantity<double, meter>;
+using kilometers = quantity<double, kilometer>;
+using millimeters = quantity<double, millimeter>;
+using kilograms = quantity<double, kilogram>;
+using grams = quantity<double, gram>;
+using seconds = quantity<double, second>;
+using milliseconds = quantity<double, millisecond>;
+using minutes = quantity<double, minute>;
+using hours = quantity<double, hour>;
+using square_meters = quantity<double, square_meter>;
+using cubic_meters = quantity<double, cubic_meter>;
+using meters_per_second = quantity<double, meter_per_second>;
+using meters_per_second_squared = quantity<double, meter_per_second_squared>;
+using kilometers_per_hour = quantity<double, kilometer_per_hour>;
+using newtons = quantity<double, newton>;
+using joules = quantity<double, joule>;
+using watts = quantity<double, watt>;
+
+}  // namespace stronger::units
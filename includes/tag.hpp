@@ -2,8 +2,8 @@
 // Licensed under the MIT License. See LICENSE file for details.
 
 #pragma once
+#include <cstddef>
 #include <source_location>
-#include <string_view>
 
 namespace stronger
 {
@@ -44,9 +44,11 @@ private:
 
     static constexpr const char* get_filename_only(const char* path)
     {
-        const std::string_view path_view(path);
-        const size_t pos = path_view.find_last_of("/\\");
-        return pos == std::string_view::npos ? path : path + pos + 1;
+        const char* filename = path;
+        for(; *path != '\0'; ++path)
+            if(*path == '/' || *path == '\\')
+                filename = path + 1;
+        return filename;
     }
 
     static constexpr std::size_t hash_combine(const std::size_t seed, const std::size_t hash_value)
@@ -0,0 +1,152 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include <type_traits>
+
+namespace stronger
+{
+
+/// Operations that can be bound between strong types. Each one applies its operator to the underlying values.
+namespace operations
+{
+
+struct addition
+{
+    static constexpr auto operator()(const auto& lhs, const auto& rhs) noexcept(noexcept(lhs + rhs))
+    {
+        return lhs + rhs;
+    }
+};
+
+struct subtraction
+{
+    static constexpr auto operator()(const auto& lhs, const auto& rhs) noexcept(noexcept(lhs - rhs))
+    {
+        return lhs - rhs;
+    }
+};
+
+struct multiplication
+{
+    static constexpr auto operator()(const auto& lhs, const auto& rhs) noexcept(noexcept(lhs * rhs))
+    {
+        return lhs * rhs;
+    }
+};
+
+struct division
+{
+    static constexpr auto operator()(const auto& lhs, const auto& rhs) noexcept(noexcept(lhs / rhs))
+    {
+        return lhs / rhs;
+    }
+};
+
+struct remainder
+{
+    static constexpr auto operator()(const auto& lhs, const auto& rhs) noexcept(noexcept(lhs % rhs))
+    {
+        return lhs % rhs;
+    }
+};
+
+struct equal_to
+{
+    static constexpr auto operator()(const auto& lhs, const auto& rhs) noexcept(noexcept(lhs == rhs))
+    {
+        return lhs == rhs;
+    }
+};
+
+struct not_equal_to
+{
+    static constexpr auto operator()(const auto& lhs, const auto& rhs) noexcept(noexcept(lhs != rhs))
+    {
+        return lhs != rhs;
+    }
+};
+
+struct less_than
+{
+    static constexpr auto operator()(const auto& lhs, const auto& rhs) noexcept(noexcept(lhs < rhs))
+    {
+        return lhs < rhs;
+    }
+};
+
+struct greater_than
+{
+    static constexpr auto operator()(const auto& lhs, const auto& rhs) noexcept(noexcept(lhs > rhs))
+    {
+        return lhs > rhs;
+    }
+};
+
+struct less_than_or_equal_to
+{
+    static constexpr auto operator()(const auto& lhs, const auto& rhs) noexcept(noexcept(lhs <= rhs))
+    {
+        return lhs <= rhs;
+    }
+};
+
+struct greater_than_or_equal_to
+{
+    static constexpr auto operator()(const auto& lhs, const auto& rhs) noexcept(noexcept(lhs >= rhs))
+    {
+        return lhs >= rhs;
+    }
+};
+
+struct three_way_comparison
+{
+    static constexpr auto operator()(const auto& lhs, const auto& rhs) noexcept(noexcept(lhs <=> rhs))
+    {
+        return lhs <=> rhs;
+    }
+};
+
+}  // namespace operations
+
+/**
+ * Customization point declaring that `Operation` is allowed between Lhs and Rhs, and results in `result`.
+ * Specialize it with a `result` member type to enable an operator between different strong types, or between a
+ * strong type and another type:
+ *
+ * template <>
+ * struct stronger::binding<stronger::operations::multiplication, Price, Quantity>
+ * {
+ *     using result = Notional;
+ * };
+ *
+ * The result is brace-initialized from the operation applied to the underlying values.
+ * Comparisons other than `three_way_comparison` are only declared for results convertible to `bool`, and
+ * `equal_to` only for `bool` results.
+ * Binding an operation between two operands of the same strong type replaces its inherited operator.
+ *
+ * @tparam Operation One of the stronger::operations
+ * @tparam Lhs Type of the left operand, without cv-qualifiers nor reference
+ * @tparam Rhs Type of the right operand, without cv-qualifiers nor reference
+ */
+template <typename Operation, typename Lhs, typename Rhs>
+struct binding
+{
+};
+
+namespace traits
+{
+
+/// binding<Operation, Lhs, Rhs> is specialized
+template <typename Operation, typename Lhs, typename Rhs>
+constexpr bool is_bound = requires {
+    typename binding<Operation, std::remove_cvref_t<Lhs>, std::remove_cvref_t<Rhs>>::result;
+};
+
+template <typename Operation, typename Lhs, typename Rhs>
+using binding_result = binding<Operation, std::remove_cvref_t<Lhs>, std::remove_cvref_t<Rhs>>::result;
+
+}  // namespace traits
+
+}  // namespace stronger
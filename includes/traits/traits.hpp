@@ -3,8 +3,8 @@
 
 #pragma once
 
-#include <ostream>
 #include <type_traits>
+#include <utility>
 
 namespace stronger::traits
 {
@@ -15,4 +15,32 @@ constexpr bool should_pass_by_value = std::is_trivially_copyable_v<T> && sizeof(
 template <typename T>
 using const_reference_like_t = std::conditional_t<should_pass_by_value<T>, T, const T&>;
 
-}  // namespace strongercpp::traits
\ No newline at end of file
+/// True if `T{ std::declval<Args>()... }` can't throw, which is how strong types initialize their underlying value
+template <typename T, typename... Args>
+constexpr bool is_nothrow_brace_constructible = noexcept(T{ std::declval<Args>()... });
+
+/// Specialize it to true to format `T` as the std::string_view returned by its `view()` member (see
+/// stronger/format.hpp)
+template <typename T>
+constexpr bool formats_as_string_view = false;
+
+/// Specialize it to true to format `T` as the value returned by its `operator*` (see stronger/format.hpp)
+template <typename T>
+constexpr bool formats_as_value = false;
+
+}  // namespace strongercpp::traits
+
+namespace stronger::internal
+{
+
+/// static_cast that does not trigger -Wuseless-cast when From is already To
+template <typename To, typename From>
+[[nodiscard]] constexpr To cast(const From value) noexcept
+{
+    if constexpr(std::is_same_v<To, From>)
+        return value;
+    else
+        return static_cast<To>(value);
+}
+
+}  // namespace stronger::internal
\ No newline at end of file
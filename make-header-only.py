@@ -5,10 +5,24 @@ here = pathlib.Path(__file__).parent.absolute()
 headers_dir = here / "includes"
 
 
+GUARD_PREFIX = "STRONGER_CPP_INCLUDED_"
+
+
+def get_guard(header_name):
+    return GUARD_PREFIX + re.sub(r"\W", "_", header_name).upper()
+
+
 def get_all_headers():
+    """
+    Content of all headers, by path relative to includes/.
+    Contents are wrapped in include guards, so that several bundled headers can be included in the same file.
+    """
     res = {}
     for file in headers_dir.rglob("*.hpp"):
-        res[str(file.relative_to(headers_dir).as_posix())] = file.read_text().split("#pragma once\n")[1] + "\n\n"
+        header_name = str(file.relative_to(headers_dir).as_posix())
+        guard = get_guard(header_name)
+        content = file.read_text().split("#pragma once\n")[1]
+        res[header_name] = f"#ifndef {guard}\n#define {guard}\n{content}\n#endif  // {guard}\n\n"
     return res
 
 
@@ -43,9 +57,22 @@ def add_license(header_content):
 
 
 def put_includes_at_top(header_content):
-    include_regex = re.compile('(#include .*)')
-    all_includes = include_regex.findall(header_content)
-    header_content = re.sub(include_regex, "", header_content)
+    """Moves includes at the top of the header, except the ones inside #if blocks, that must stay conditional"""
+    all_includes = []
+    lines = []
+    depth = 0
+    for line in header_content.split("\n"):
+        if line.startswith((f"#ifndef {GUARD_PREFIX}", f"#endif  // {GUARD_PREFIX}")):
+            pass  # Include guards are not conditional includes
+        elif re.match(r"\s*#\s*if", line):
+            depth += 1
+        elif re.match(r"\s*#\s*endif", line):
+            depth -= 1
+        elif depth == 0 and line.startswith("#include "):
+            all_includes.append(line)
+            continue
+        lines.append(line)
+    header_content = "\n".join(lines)
     header_parts = header_content.split("#pragma once\n")
     header_parts.insert(1, f"#pragma once\n\n{'\n'.join(set(all_includes))}\n\n")
     return "".join(header_parts)
@@ -55,16 +82,23 @@ def limit_newlines(header_content):
     return re.sub(r'\n{2,}', '\n\n', header_content)
 
 
+def make_header_only(header_name, all_headers):
+    header_only_content = "#pragma once\n" + replace_includes(f'#include "{header_name}"', all_headers)
+    header_only_content = put_includes_at_top(header_only_content)
+    header_only_content = limit_newlines(header_only_content)
+    return add_license(header_only_content)
+
+
 if __name__ == "__main__":
     print("Making header-only version of stronger-cpp ...")
-    main_header = headers_dir / "stronger.hpp"
     all_headers = get_all_headers()
-    header_only_content = replace_includes(main_header.read_text(), all_headers)
-    header_only_content = put_includes_at_top(header_only_content)
-    header_only_content = limit_newlines(header_only_content)
-    header_only_content = add_license(header_only_content)
     public_dir = here / "public"
-    public_dir.mkdir(exist_ok=True)
-    target_file = (public_dir / main_header.name)
-    target_file.write_text(header_only_content)
-    print(f"Header-only version of stronger-cpp created at {target_file}")
+    # stronger.hpp bundles the core with formatting, stream insertion and hashing. Headers of includes/stronger/ are
+    # bundled on their own, for the opt-in features and for users who only need a part of the library.
+    partial_headers = sorted(str(file.relative_to(headers_dir).as_posix())
+                             for file in (headers_dir / "stronger").rglob("*.hpp"))
+    for header_name in ["stronger.hpp"] + partial_headers:
+        target_file = public_dir / header_name
+        target_file.parent.mkdir(parents=True, exist_ok=True)
+        target_file.write_text(make_header_only(header_name, all_headers))
+        print(f"Header-only version of {header_name} created at {target_file}")
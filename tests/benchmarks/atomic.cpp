@@ -0,0 +1,63 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include <algorithm>
+#include <atomic>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <stronger.hpp>
+#include <stronger/atomic.hpp>
+#include <thread>
+#include <vector>
+
+namespace stronger::tests::benchmarks
+{
+
+namespace
+{
+
+using SequenceNumber = strong_type<uint64_t, tag()>;
+
+constexpr uint64_t IncrementsPerThread = 1'000'000ULL;
+
+/// Every thread increments the same counter, so that all of them contend on the same cache line
+template <typename Atomic, typename Increment>
+void contend(Atomic& counter, const Increment increment)
+{
+    const unsigned threadCount = std::max(std::thread::hardware_concurrency(), 2U);
+    std::vector<std::jthread> threads;
+    threads.reserve(threadCount);
+    for(unsigned i = 0; i < threadCount; ++i)
+        threads.emplace_back([&counter, increment] {
+            for(uint64_t j = 0; j < IncrementsPerThread; ++j)
+                counter.fetch_add(increment, std::memory_order_relaxed);
+        });
+}
+
+}  // namespace
+
+TEST_CASE("Benchmark: contended std::atomic<uint64_t> vs std::atomic<strong_type>", "[benchmark]")
+{
+    SECTION("std::atomic<uint64_t>")
+    {
+        std::atomic<uint64_t> counter;
+        BENCHMARK("std::atomic<uint64_t>")
+        {
+            contend(counter, uint64_t{ 1U });
+            return counter.load();
+        };
+    }
+
+    SECTION("std::atomic<SequenceNumber>")
+    {
+        std::atomic<SequenceNumber> counter;
+        BENCHMARK("std::atomic<SequenceNumber>")
+        {
+            contend(counter, SequenceNumber{ 1U });
+            return counter.load();
+        };
+    }
+}
+
+}  // namespace stronger::tests::benchmarks
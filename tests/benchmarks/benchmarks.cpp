@@ -5,11 +5,41 @@
 #include "./NamedType/named_type.hpp"
 #include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <cstdlib>
+#include <new>
 #include <random>
 #include <ranges>
+#include <string>
 #include <stronger.hpp>
 
+// Heap allocations are counted so that benchmarks can compare how many buffers are allocated by strong types and by
+// their underlying types. The count is atomic, since other benchmarks of this binary allocate from several threads.
+namespace
+{
+std::atomic<std::size_t> allocation_count = 0;
+}
+
+void* operator new(const std::size_t size)
+{
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if(void* ptr = std::malloc(size))
+        return ptr;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
 namespace stronger::tests::benchmarks
 {
 
@@ -18,6 +48,7 @@ namespace
 
 using NamedTypeDouble = fluent::NamedType<double, struct DoubleTag, fluent::Arithmetic>;
 using StrongerDouble = strong_type<double, tag()>;
+using StrongerString = strong_type<std::string, tag()>;
 
 constexpr size_t Iterations = 10'000'000ULL;
 
@@ -46,6 +77,29 @@ void benchmark(const auto& a, const auto& b, auto& result)
         valueResult = valueA + valueB * (valueA - valueB) / (valueA + valueB);
 }
 
+template <typename String>
+String concatenate(const String& a, const String& b, const String& c, const String& d)
+{
+    return a + b + c + d;
+}
+
+/// Builds long strings so that they don't fit in the small string buffer
+template <typename String>
+std::array<String, 4> get_concatenation_params()
+{
+    return { String(std::string(32, 'a')), String(std::string(32, 'b')), String(std::string(32, 'c')),
+             String(std::string(32, 'd')) };
+}
+
+template <typename String>
+std::size_t count_concatenation_allocations()
+{
+    const auto [a, b, c, d] = get_concatenation_params<String>();
+    const std::size_t before = allocation_count.load(std::memory_order_relaxed);
+    [[maybe_unused]] const String result = concatenate(a, b, c, d);
+    return allocation_count.load(std::memory_order_relaxed) - before;
+}
+
 }  // namespace
 
 TEST_CASE("Benchmark: NamedTypeDouble vs StrongerDouble Addition Performance", "[benchmark]")
@@ -81,4 +135,30 @@ TEST_CASE("Benchmark: NamedTypeDouble vs StrongerDouble Addition Performance", "
     }
 }
 
+TEST_CASE("Benchmark: std::string vs StrongerString concatenation", "[benchmark]")
+{
+    SECTION("Intermediate results reuse their storage")
+    {
+        CHECK(count_concatenation_allocations<StrongerString>() == count_concatenation_allocations<std::string>());
+    }
+
+    SECTION("std::string concatenation")
+    {
+        const auto [a, b, c, d] = get_concatenation_params<std::string>();
+        BENCHMARK("std::string")
+        {
+            return concatenate(a, b, c, d);
+        };
+    }
+
+    SECTION("stronger-cpp concatenation")
+    {
+        const auto [a, b, c, d] = get_concatenation_params<StrongerString>();
+        BENCHMARK("stronger-cpp")
+        {
+            return concatenate(a, b, c, d);
+        };
+    }
+}
+
 }  // namespace stronger::tests::benchmarks
\ No newline at end of file
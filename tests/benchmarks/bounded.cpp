@@ -0,0 +1,89 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <stronger.hpp>
+#include <stronger/bounded.hpp>
+#include <vector>
+
+namespace stronger::tests::benchmarks
+{
+
+namespace
+{
+
+using Level = bounded_type<int32_t, -1000, 1000, bound_policy::saturate, tag()>;
+using UncheckedLevel = bounded_type<int32_t, -1000, 1000, bound_policy::unchecked, tag()>;
+
+constexpr size_t Samples = 1'000'000ULL;
+
+}  // namespace
+
+TEST_CASE("Benchmark: accumulating bounded values", "[benchmark]")
+{
+    std::vector<int32_t> raw(Samples);
+    for(size_t i = 0; i < Samples; ++i)
+        raw[i] = static_cast<int32_t>(i % 401) - 200;
+    std::vector<Level> saturated;
+    std::vector<UncheckedLevel> unchecked;
+    saturated.reserve(Samples);
+    unchecked.reserve(Samples);
+    for(const int32_t sample : raw)
+    {
+        saturated.emplace_back(sample);
+        unchecked.emplace_back(sample);
+    }
+
+    // Both versions must compute the same thing to compare them
+    int32_t expected = 0;
+    for(const int32_t sample : raw)
+        expected = std::clamp(expected + sample, -1000, 1000);
+    Level level{};
+    for(const Level sample : saturated)
+        level += sample;
+    CHECK(**level == expected);
+
+    SECTION("Raw arithmetic")
+    {
+        BENCHMARK("No strong type, manual clamping")
+        {
+            int32_t sum = 0;
+            for(const int32_t sample : raw)
+                sum = std::clamp(sum + sample, -1000, 1000);
+            return sum;
+        };
+
+        BENCHMARK("No strong type, no clamping")
+        {
+            int32_t sum = 0;
+            for(const int32_t sample : raw)
+                sum += sample;
+            return sum;
+        };
+    }
+
+    SECTION("bounded")
+    {
+        BENCHMARK("bound_policy::saturate")
+        {
+            Level sum{};
+            for(const Level sample : saturated)
+                sum += sample;
+            return sum;
+        };
+
+        BENCHMARK("bound_policy::unchecked")
+        {
+            UncheckedLevel sum{};
+            for(const UncheckedLevel sample : unchecked)
+                sum += sample;
+            return sum;
+        };
+    }
+}
+
+}  // namespace stronger::tests::benchmarks
@@ -0,0 +1,128 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <stronger.hpp>
+#include <stronger/charconv.hpp>
+#include <vector>
+
+namespace stronger::tests::benchmarks
+{
+
+namespace
+{
+
+using Price = strong_type<double, tag()>;
+using Volume = strong_type<int64_t, tag()>;
+
+constexpr size_t Ticks = 100'000ULL;
+
+}  // namespace
+
+// Each benchmark writes or reads Ticks lines of tick data: "price,volume\n"
+TEST_CASE("Benchmark: text conversions", "[benchmark]")
+{
+    std::vector<Price> prices;
+    std::vector<Volume> volumes;
+    prices.reserve(Ticks);
+    volumes.reserve(Ticks);
+    for(size_t i = 0; i < Ticks; ++i)
+    {
+        prices.emplace_back(100.0 + static_cast<double>(i % 400) * 0.25);
+        volumes.emplace_back(static_cast<int64_t>(i * 37 % 100'000));
+    }
+
+    std::string text;
+    for(size_t i = 0; i < Ticks; ++i)
+        text += std::format("{},{}\n", *prices[i], *volumes[i]);
+
+    SECTION("Formatting")
+    {
+        BENCHMARK("stronger::to_chars")
+        {
+            std::string out(Ticks * 32, '\0');
+            char* first = out.data();
+            char* const last = out.data() + out.size();
+            for(size_t i = 0; i < Ticks; ++i)
+            {
+                first = to_chars(first, last, prices[i]).ptr;
+                *first++ = ',';
+                first = to_chars(first, last, volumes[i]).ptr;
+                *first++ = '\n';
+            }
+            out.resize(static_cast<size_t>(first - out.data()));
+            return out;
+        };
+
+        BENCHMARK("std::format_to")
+        {
+            std::string out;
+            out.reserve(Ticks * 32);
+            for(size_t i = 0; i < Ticks; ++i)
+                std::format_to(std::back_inserter(out), "{},{}\n", prices[i], volumes[i]);
+            return out;
+        };
+
+        BENCHMARK("operator<<")
+        {
+            std::ostringstream out;
+            for(size_t i = 0; i < Ticks; ++i)
+                out << prices[i] << ',' << volumes[i] << '\n';
+            return out.str();
+        };
+    }
+
+    SECTION("Parsing")
+    {
+        BENCHMARK("stronger::from_chars")
+        {
+            std::vector<Price> parsedPrices(Ticks);
+            std::vector<Volume> parsedVolumes(Ticks);
+            const char* first = text.data();
+            const char* const last = text.data() + text.size();
+            for(size_t i = 0; i < Ticks; ++i)
+            {
+                first = from_chars(first, last, parsedPrices[i]).ptr + 1;
+                first = from_chars(first, last, parsedVolumes[i]).ptr + 1;
+            }
+            return parsedVolumes.back();
+        };
+
+        BENCHMARK("stronger::parse")
+        {
+            std::vector<Price> parsedPrices(Ticks);
+            std::vector<Volume> parsedVolumes(Ticks);
+            std::string_view rest = text;
+            for(size_t i = 0; i < Ticks; ++i)
+            {
+                const size_t comma = rest.find(',');
+                const size_t end = rest.find('\n', comma);
+                parsedPrices[i] = parse<Price>(rest.substr(0, comma)).value_or(Price{});
+                parsedVolumes[i] = parse<Volume>(rest.substr(comma + 1, end - comma - 1)).value_or(Volume{});
+                rest.remove_prefix(end + 1);
+            }
+            return parsedVolumes.back();
+        };
+
+        BENCHMARK("operator>> of the underlying types")
+        {
+            std::vector<Price> parsedPrices(Ticks);
+            std::vector<Volume> parsedVolumes(Ticks);
+            std::istringstream in(text);
+            char separator = 0;
+            for(size_t i = 0; i < Ticks; ++i)
+                in >> *parsedPrices[i] >> separator >> *parsedVolumes[i];
+            return parsedVolumes.back();
+        };
+    }
+}
+
+}  // namespace stronger::tests::benchmarks
@@ -8,6 +8,16 @@
     #define STRONG_TYPE(Name, Type)  using Name = ::stronger::strong_type<Type, ::stronger::tag()>
     #define MAKE_STRONG(Type, Value) ::stronger::make_strong<Type>(Value)
     #define ACCESS                   ->
+#elifdef COMPILE_TIME_BENCHMARK_STRONGER_CORE
+    #include "../../public/stronger/core.hpp"
+    #define STRONG_TYPE(Name, Type)  using Name = ::stronger::strong_type<Type, ::stronger::tag()>
+    #define MAKE_STRONG(Type, Value) ::stronger::make_strong<Type>(Value)
+    #define ACCESS                   ->
+#elifdef COMPILE_TIME_BENCHMARK_STRONGER_MODULE
+import stronger;
+    #define STRONG_TYPE(Name, Type)  using Name = ::stronger::strong_type<Type, ::stronger::tag()>
+    #define MAKE_STRONG(Type, Value) ::stronger::make_strong<Type>(Value)
+    #define ACCESS                   ->
 #elifdef COMPILE_TIME_BENCHMARK_NAMED_TYPE
     #include "./NamedType/named_type.hpp"
     #define STRONG_TYPE(Name, Type)                                                                        \
@@ -41,6 +51,43 @@ STRONG_TYPE(VectorInt, std::vector<int>);
 STRONG_TYPE(VectorDouble, std::vector<double>);
 STRONG_TYPE(VectorString, std::vector<String>);
 
+#ifdef COMPILE_TIME_BENCHMARK_BINDINGS
+// stronger-cpp only: operations between different strong types, declared with stronger::binding
+    #include <compare>
+
+STRONG_TYPE(Price, double);
+STRONG_TYPE(Quantity, double);
+STRONG_TYPE(Notional, double);
+STRONG_TYPE(Timestamp, long);
+STRONG_TYPE(Duration, long);
+
+template <>
+struct stronger::binding<stronger::operations::multiplication, Price, Quantity>
+{
+    using result = Notional;
+};
+
+template <>
+struct stronger::binding<stronger::operations::subtraction, Timestamp, Timestamp>
+{
+    using result = Duration;
+};
+
+template <>
+struct stronger::binding<stronger::operations::three_way_comparison, Notional, Double3>
+{
+    using result = std::partial_ordering;
+};
+
+bool bindings(Price p, Quantity q, Timestamp start, Timestamp stop, Double3 limit)
+{
+    const Notional notional = p * q;
+    const Duration duration = stop - start;
+    std::ignore = duration;
+    return notional < limit;
+}
+#endif
+
 String concat(String a, String b)
 {
     return a + b;
@@ -100,6 +147,9 @@ int main()
     std::ignore = vi;
     std::ignore = vd;
     std::ignore = vs;
+#ifdef COMPILE_TIME_BENCHMARK_BINDINGS
+    std::ignore = bindings(Price(1.0), Quantity(2.0), Timestamp(1), Timestamp(2), Double3(3.0));
+#endif
 }
 #else
 int main()
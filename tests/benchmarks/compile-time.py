@@ -1,13 +1,23 @@
+import shutil
 import time
 from pathlib import Path
 import subprocess
 
 CURRENT_DIR = Path(__file__).parent
+INCLUDES_DIR = CURRENT_DIR.parent.parent / "includes"
+COMPILE_OPTIONS = ["-std=c++23", "-O3"]
 
 
-def compile_benchmark(iterations, *defines):
-    compile_options = ["compile-time.cpp", "-o", "compile-time", "-std=c++23", "-O3"]
-    command = ["g++"] + compile_options + [f"-D{define}" for define in defines]
+def run(command):
+    print("Running:", *command, sep=" ")
+    result = subprocess.run(command, cwd=CURRENT_DIR)
+    if result.returncode != 0:
+        raise RuntimeError("Compilation failed")
+
+
+def compile_benchmark(iterations, *defines, compiler="g++", extra_options=()):
+    compile_options = ["compile-time.cpp", "-o", "compile-time"] + COMPILE_OPTIONS + list(extra_options)
+    command = [compiler] + compile_options + [f"-D{define}" for define in defines]
     print("Running:", *command, sep=" ")
 
     start = time.time()
@@ -21,12 +31,12 @@ def compile_benchmark(iterations, *defines):
     return delta
 
 
-def compile_all(name, iterations, *define):
+def compile_all(name, iterations, *define, compiler="g++", extra_options=()):
     print(15 * "=", f"{name.upper()}", 15 * "=")
     print(f"Compiling {name} (include only)...")
-    header = compile_benchmark(iterations, "INCLUDE_ONLY", *define)
+    header = compile_benchmark(iterations, "INCLUDE_ONLY", *define, compiler=compiler, extra_options=extra_options)
     print(f"Compiling {name} ...")
-    full = compile_benchmark(iterations, *define)
+    full = compile_benchmark(iterations, *define, compiler=compiler, extra_options=extra_options)
     print("=" * 30, "\n", sep="")
     return header, full
 
@@ -39,10 +49,67 @@ def compile_stronger(iterations):
     return compile_all("Stronger", iterations, "COMPILE_TIME_BENCHMARK_STRONGER")
 
 
+def compile_stronger_core(iterations):
+    print(15 * "=", "STRONGER CORE", 15 * "=")
+    print("Compiling Stronger core (include only)...")
+    header = compile_benchmark(iterations, "INCLUDE_ONLY", "COMPILE_TIME_BENCHMARK_STRONGER_CORE")
+    print("=" * 30, "\n", sep="")
+    return header
+
+
+def compile_stronger_bindings(iterations):
+    print(15 * "=", "STRONGER BINDINGS", 15 * "=")
+    print("Compiling Stronger with operation bindings...")
+    full = compile_benchmark(iterations, "COMPILE_TIME_BENCHMARK_STRONGER", "COMPILE_TIME_BENCHMARK_BINDINGS")
+    print("=" * 30, "\n", sep="")
+    return full
+
+
 def compile_no_strong_type(iterations):
     return compile_all("NoStrongType", iterations, "INCLUDE_ONLY")
 
 
+def build_module(compiler):
+    """Builds the stronger module once, and returns the options to import it. Not part of the measured time."""
+    interface = str(INCLUDES_DIR / "stronger.cppm")
+    if compiler == "g++":
+        # g++ takes .cppm files for linker input: without -x c++, it would build nothing and still succeed
+        run([compiler, *COMPILE_OPTIONS, "-fmodules-ts", f"-I{INCLUDES_DIR}", "-c", "-x", "c++", interface, "-o",
+             "stronger.o"])
+        return ["-fmodules-ts", "stronger.o"]
+    run([compiler, *COMPILE_OPTIONS, f"-I{INCLUDES_DIR}", "--precompile", interface, "-o", "stronger.pcm"])
+    run([compiler, *COMPILE_OPTIONS, "-c", "stronger.pcm", "-o", "stronger.o"])
+    return ["-fmodule-file=stronger=stronger.pcm", "stronger.o"]
+
+
+def compile_include_vs_import(iterations):
+    """Compares including stronger.hpp with importing the stronger module, for each available compiler"""
+    results = {}
+    for compiler in ("g++", "clang++"):
+        if shutil.which(compiler) is None:
+            print(f"{compiler} not found, skipping include vs import comparison")
+            continue
+        include = compile_all(f"Stronger include ({compiler})", iterations, "COMPILE_TIME_BENCHMARK_STRONGER",
+                              compiler=compiler)
+        module_options = build_module(compiler)
+        imported = compile_all(f"Stronger import ({compiler})", iterations, "COMPILE_TIME_BENCHMARK_STRONGER_MODULE",
+                               compiler=compiler, extra_options=module_options)
+        results[compiler] = include, imported
+    return results
+
+
+def render_include_vs_import(results):
+    rows = ["| Compiler | `#include` (header only) | `import` (header only) | `#include` (complete file) | "
+            "`import` (complete file) |",
+            "|----------|--------------------------|------------------------|----------------------------|"
+            "--------------------------|"]
+    for compiler, ((include_header, include_full), (import_header, import_full)) in results.items():
+        rows.append(f"| {compiler} | {include_header:.2f} s | {import_header:.2f} s "
+                    f"({get_performance(import_header, include_header)}) | {include_full:.2f} s | {import_full:.2f} s "
+                    f"({get_performance(import_full, include_full)}) |")
+    return "\n".join(rows)
+
+
 def render_results(settings):
     template = CURRENT_DIR / "results.md.template"
     content = template.read_text(encoding="utf-8")
@@ -73,20 +140,31 @@ if __name__ == "__main__":
 
     named_type_header, named_type_full = compile_named_type(ITERATIONS)
     stronger_header, stronger_full = compile_stronger(ITERATIONS)
+    stronger_core_header = compile_stronger_core(ITERATIONS)
+    stronger_bindings_full = compile_stronger_bindings(ITERATIONS)
     no_strong_type_header, no_strong_type_full = compile_no_strong_type(ITERATIONS)
+    include_vs_import = compile_include_vs_import(ITERATIONS)
 
     settings["__N_ITERATIONS__"] = ITERATIONS
-    settings["__MAX_Y_HEADER__"] = get_y_max(named_type_header, stronger_header, no_strong_type_header)
+    settings["__MAX_Y_HEADER__"] = get_y_max(named_type_header, stronger_header, stronger_core_header,
+                                             no_strong_type_header)
     settings["__MAX_Y_FULL__"] = get_y_max(named_type_full, stronger_full, no_strong_type_full)
     settings["__NO_STRONG_TYPE_HEADER__"] = no_strong_type_header
     settings["__NO_STRONG_TYPE_FULL__"] = no_strong_type_full
     settings["__NAMED_TYPE_HEADER__"] = named_type_header
     settings["__NAMED_TYPE_FULL__"] = named_type_full
     settings["__STRONGER_CPP_HEADER__"] = stronger_header
+    settings["__STRONGER_CPP_CORE_HEADER__"] = stronger_core_header
     settings["__STRONGER_CPP_FULL__"] = stronger_full
     settings["__STRONGER_CPP_VS_NAMED_TYPE_HEADER__"] = get_performance(stronger_header, named_type_header)
     settings["__STRONGER_CPP_VS_NAMED_TYPE_FULL__"] = get_performance(stronger_full, named_type_full)
     settings["__STRONGER_CPP_VS_NO_STRONG_TYPE_HEADER__"] = get_performance(stronger_header, no_strong_type_header)
+    settings["__STRONGER_CPP_CORE_VS_NO_STRONG_TYPE_HEADER__"] = get_performance(stronger_core_header,
+                                                                                 no_strong_type_header)
+    settings["__STRONGER_CPP_VS_CORE_HEADER__"] = get_performance(stronger_header, stronger_core_header)
     settings["__STRONGER_CPP_VS_NO_STRONG_TYPE_FULL__"] = get_performance(stronger_full, no_strong_type_full)
+    settings["__STRONGER_CPP_BINDINGS_FULL__"] = round(stronger_bindings_full, 2)
+    settings["__STRONGER_CPP_BINDINGS_VS_FULL__"] = get_performance(stronger_bindings_full, stronger_full)
+    settings["__INCLUDE_VS_IMPORT__"] = render_include_vs_import(include_vs_import)
 
     render_results(settings)
@@ -0,0 +1,80 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <stronger.hpp>
+#include <stronger/elementwise.hpp>
+#include <vector>
+
+namespace stronger::tests::benchmarks
+{
+
+namespace
+{
+
+using Signal = strong_type<std::vector<double>, tag(), options::elementwise>;
+
+constexpr size_t Samples = 1'000'000ULL;
+
+std::vector<double> add(const std::vector<double>& lhs, const std::vector<double>& rhs)
+{
+    std::vector<double> result(lhs.size());
+    for(size_t i = 0; i < lhs.size(); ++i)
+        result[i] = lhs[i] + rhs[i];
+    return result;
+}
+
+std::vector<double> multiply(const std::vector<double>& lhs, const std::vector<double>& rhs)
+{
+    std::vector<double> result(lhs.size());
+    for(size_t i = 0; i < lhs.size(); ++i)
+        result[i] = lhs[i] * rhs[i];
+    return result;
+}
+
+}  // namespace
+
+TEST_CASE("Benchmark: a + b * c with temporaries vs elementwise expressions", "[benchmark]")
+{
+    const std::vector<double> a(Samples, 1.0);
+    const std::vector<double> b(Samples, 2.0);
+    const std::vector<double> c(Samples, 3.0);
+
+    SECTION("Element-wise loops with temporaries")
+    {
+        std::vector<double> result;
+        BENCHMARK("Temporaries")
+        {
+            result = add(a, multiply(b, c));
+            return result.back();
+        };
+    }
+
+    SECTION("Hand-written fused loop")
+    {
+        std::vector<double> result(Samples);
+        BENCHMARK("Hand-written")
+        {
+            for(size_t i = 0; i < Samples; ++i)
+                result[i] = a[i] + b[i] * c[i];
+            return result.back();
+        };
+    }
+
+    SECTION("Elementwise expression")
+    {
+        const Signal strongA{ a };
+        const Signal strongB{ b };
+        const Signal strongC{ c };
+        Signal result{ std::vector<double>(Samples) };
+        BENCHMARK("options::elementwise")
+        {
+            result = strongA + strongB * strongC;
+            return result->back();
+        };
+    }
+}
+
+}  // namespace stronger::tests::benchmarks
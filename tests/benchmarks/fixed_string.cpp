@@ -0,0 +1,83 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <string>
+#include <stronger.hpp>
+#include <stronger/fixed_string.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace stronger::tests::benchmarks
+{
+
+namespace
+{
+
+using Ticker = strong_type<std::string, tag()>;
+using FixedTicker = fixed_string_type<8, tag()>;
+
+constexpr size_t Trades = 1'000'000ULL;
+constexpr size_t Tickers = 5'000ULL;
+
+std::string ticker_name(const size_t i)
+{
+    // Short codes, like most identifiers, currencies or tickers
+    return "TK" + std::to_string(i % Tickers);
+}
+
+}  // namespace
+
+TEST_CASE("Benchmark: fixed strings", "[benchmark]")
+{
+    std::vector<Ticker> tickers;
+    std::vector<FixedTicker> fixedTickers;
+    tickers.reserve(Trades);
+    fixedTickers.reserve(Trades);
+    for(size_t i = 0; i < Trades; ++i)
+    {
+        tickers.emplace_back(ticker_name(i * 7919));
+        fixedTickers.emplace_back(fixed_string<8>(ticker_name(i * 7919)));
+    }
+
+    BENCHMARK("Sort, strong_type<std::string>")
+    {
+        std::vector<Ticker> sorted = tickers;
+        std::ranges::sort(sorted);
+        return sorted;
+    };
+
+    BENCHMARK("Sort, fixed_string_type")
+    {
+        std::vector<FixedTicker> sorted = fixedTickers;
+        std::ranges::sort(sorted);
+        return sorted;
+    };
+
+    std::unordered_map<Ticker, size_t> volumes;
+    std::unordered_map<FixedTicker, size_t> fixedVolumes;
+    for(size_t i = 0; i < Tickers; ++i)
+    {
+        volumes.emplace(Ticker{ ticker_name(i) }, 0);
+        fixedVolumes.emplace(FixedTicker{ fixed_string<8>(ticker_name(i)) }, 0);
+    }
+
+    BENCHMARK("Map lookups, strong_type<std::string>")
+    {
+        for(const Ticker& ticker : tickers)
+            ++volumes.find(ticker)->second;
+        return volumes.size();
+    };
+
+    BENCHMARK("Map lookups, fixed_string_type")
+    {
+        for(const FixedTicker& ticker : fixedTickers)
+            ++fixedVolumes.find(ticker)->second;
+        return fixedVolumes.size();
+    };
+}
+
+}  // namespace stronger::tests::benchmarks
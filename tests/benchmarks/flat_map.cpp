@@ -0,0 +1,124 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stronger.hpp>
+#include <stronger/containers/flat_map.hpp>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <version>
+#ifdef __cpp_lib_flat_map
+#include <flat_map>
+#endif
+
+namespace stronger::tests::benchmarks
+{
+
+namespace
+{
+
+using RouteId = strong_type<uint32_t, tag()>;
+
+struct Route
+{
+    uint32_t gateway;
+    uint32_t metric;
+};
+
+constexpr size_t Routes = 100'000ULL;
+constexpr size_t Lookups = 1'000'000ULL;
+
+/// Sparse identifiers, half of the lookups miss
+std::vector<std::pair<RouteId, Route>> get_routes()
+{
+    std::mt19937 generator(42);
+    std::vector<std::pair<RouteId, Route>> routes;
+    routes.reserve(Routes);
+    for(uint32_t i = 0; i < Routes; ++i)
+        routes.emplace_back(RouteId{ static_cast<uint32_t>(generator() % (2 * Routes)) }, Route{ i, i % 16 });
+    return routes;
+}
+
+std::vector<RouteId> get_lookups()
+{
+    std::mt19937 generator(7);
+    std::vector<RouteId> lookups;
+    lookups.reserve(Lookups);
+    for(size_t i = 0; i < Lookups; ++i)
+        lookups.emplace_back(static_cast<uint32_t>(generator() % (2 * Routes)));
+    return lookups;
+}
+
+template <typename Map>
+uint64_t lookup(const Map& map, const std::vector<RouteId>& lookups)
+{
+    uint64_t metrics = 0;
+    for(const RouteId id : lookups)
+        if(const auto found = map.find(id); found != map.end())
+            metrics += found->second.metric;
+    return metrics;
+}
+
+template <typename Map>
+uint64_t iterate(const Map& map)
+{
+    uint64_t metrics = 0;
+    for(const auto& [id, route] : map)
+        metrics += *id + route.metric;
+    return metrics;
+}
+
+}  // namespace
+
+TEST_CASE("Benchmark: flat map", "[benchmark]")
+{
+    const std::vector<std::pair<RouteId, Route>> routes = get_routes();
+    const std::vector<RouteId> lookups = get_lookups();
+
+    const flat_map<RouteId, Route> flatMap(routes);
+    const std::unordered_map<RouteId, Route> unorderedMap(routes.begin(), routes.end());
+#ifdef __cpp_lib_flat_map
+    const std::flat_map<RouteId, Route> stdFlatMap(routes.begin(), routes.end());
+#endif
+
+    BENCHMARK("Lookups, stronger::flat_map")
+    {
+        return lookup(flatMap, lookups);
+    };
+
+#ifdef __cpp_lib_flat_map
+    BENCHMARK("Lookups, std::flat_map")
+    {
+        return lookup(stdFlatMap, lookups);
+    };
+#endif
+
+    BENCHMARK("Lookups, std::unordered_map")
+    {
+        return lookup(unorderedMap, lookups);
+    };
+
+    BENCHMARK("Iteration, stronger::flat_map")
+    {
+        return iterate(flatMap);
+    };
+
+#ifdef __cpp_lib_flat_map
+    BENCHMARK("Iteration, std::flat_map")
+    {
+        return iterate(stdFlatMap);
+    };
+#endif
+
+    BENCHMARK("Iteration, std::unordered_map")
+    {
+        return iterate(unorderedMap);
+    };
+}
+
+}  // namespace stronger::tests::benchmarks
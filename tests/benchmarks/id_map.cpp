@@ -0,0 +1,115 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <stronger.hpp>
+#include <stronger/containers/id_map.hpp>
+#include <unordered_map>
+
+namespace stronger::tests::benchmarks
+{
+
+namespace
+{
+
+using EntityId = strong_type<uint32_t, tag()>;
+
+/// Identifier number `i`: sequential ones are given to entities, and spaced ones encode other bits below the index
+EntityId id(const uint64_t i, const uint64_t stride)
+{
+    return EntityId{ static_cast<uint32_t>(i * stride) };
+}
+
+/// std::hash is the identity on the identifiers
+template <typename Map>
+Map insert(const uint64_t count, const uint64_t stride)
+{
+    Map map;
+    for(uint64_t i = 0; i < count; ++i)
+        map.try_emplace(id(i, stride), static_cast<uint32_t>(i));
+    return map;
+}
+
+/// Looks up every key and as many missing ones, in scattered order: multiplying by a prime modulo 2 * count visits
+/// each identifier once
+template <typename Map>
+uint64_t lookup(const Map& map, const uint64_t count, const uint64_t stride)
+{
+    uint64_t sum = 0;
+    for(uint64_t i = 0; i < 2 * count; ++i)
+    {
+        if(const auto found = map.find(id(i * 2'654'435'761ULL % (2 * count), stride)); found != map.end())
+            sum += found->second;
+    }
+    return sum;
+}
+
+/// Erases every other key, and inserts them back: the map ends up with the same elements
+template <typename Map>
+size_t erase(Map& map, const uint64_t count, const uint64_t stride)
+{
+    for(uint64_t i = 0; i < count; i += 2)
+        map.erase(id(i, stride));
+    for(uint64_t i = 0; i < count; i += 2)
+        map.try_emplace(id(i, stride), static_cast<uint32_t>(i));
+    return map.size();
+}
+
+void run_benchmarks(const uint64_t count, const uint64_t stride = 1)
+{
+    BENCHMARK("Insert, std::unordered_map")
+    {
+        return insert<std::unordered_map<EntityId, uint32_t>>(count, stride).size();
+    };
+
+    BENCHMARK("Insert, id_map")
+    {
+        return insert<id_map<EntityId, uint32_t>>(count, stride).size();
+    };
+
+    auto unorderedMap = insert<std::unordered_map<EntityId, uint32_t>>(count, stride);
+    auto idMap = insert<id_map<EntityId, uint32_t>>(count, stride);
+
+    BENCHMARK("Lookup, std::unordered_map")
+    {
+        return lookup(unorderedMap, count, stride);
+    };
+
+    BENCHMARK("Lookup, id_map")
+    {
+        return lookup(idMap, count, stride);
+    };
+
+    BENCHMARK("Erase and insert back, std::unordered_map")
+    {
+        return erase(unorderedMap, count, stride);
+    };
+
+    BENCHMARK("Erase and insert back, id_map")
+    {
+        return erase(idMap, count, stride);
+    };
+}
+
+}  // namespace
+
+TEST_CASE("Benchmark: id map, 1M keys", "[benchmark]")
+{
+    run_benchmarks(1'000'000ULL);
+}
+
+TEST_CASE("Benchmark: id map, 1M keys 128 apart", "[benchmark]")
+{
+    run_benchmarks(1'000'000ULL, 128);
+}
+
+// Needs about 10 GB of memory, mostly for std::unordered_map: run it explicitly
+TEST_CASE("Benchmark: id map, 100M keys", "[.][benchmark]")
+{
+    run_benchmarks(100'000'000ULL);
+}
+
+}  // namespace stronger::tests::benchmarks
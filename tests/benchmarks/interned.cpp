@@ -0,0 +1,108 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <stronger.hpp>
+#include <stronger/interned.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace stronger::tests::benchmarks
+{
+
+namespace
+{
+
+using MetricName = strong_type<std::string, tag()>;
+using InternedMetricName = interned<tag()>;
+
+constexpr size_t Samples = 1'000'000ULL;
+constexpr size_t Metrics = 1'000ULL;
+
+std::string metric_name(const size_t i)
+{
+    return "service.requests.latency.p99.host-" + std::to_string(i % Metrics);
+}
+
+/// Bytes used by the strings, including their heap allocations, but not the allocator overhead
+size_t footprint(const std::vector<MetricName>& names)
+{
+    size_t bytes = names.capacity() * sizeof(MetricName);
+    for(const MetricName& name : names)
+        if(name->capacity() > std::string{}.capacity())
+            bytes += name->capacity() + 1;
+    return bytes;
+}
+
+size_t footprint(const std::vector<InternedMetricName>& names)
+{
+    size_t bytes = names.capacity() * sizeof(InternedMetricName);
+    for(size_t i = 0; i < Metrics; ++i)
+        bytes += metric_name(i).size() + sizeof(std::string_view);  // Arena and handle table of the pool
+    return bytes;
+}
+
+}  // namespace
+
+// Samples of metrics with heavy duplication: 1'000 different names for 1'000'000 samples
+TEST_CASE("Benchmark: interned strings", "[benchmark]")
+{
+    std::vector<MetricName> names;
+    std::vector<InternedMetricName> internedNames;
+    names.reserve(Samples);
+    internedNames.reserve(Samples);
+    for(size_t i = 0; i < Samples; ++i)
+    {
+        names.emplace_back(metric_name(i * 7));
+        internedNames.emplace_back(metric_name(i * 7));
+    }
+
+    WARN("Memory footprint, strong_type<std::string>: " << footprint(names) << " bytes");
+    WARN("Memory footprint, interned: " << footprint(internedNames) << " bytes");
+
+    std::unordered_map<MetricName, size_t> counts;
+    std::unordered_map<InternedMetricName, size_t> internedCounts;
+    for(size_t i = 0; i < Metrics; ++i)
+    {
+        counts.emplace(MetricName{ metric_name(i) }, 0);
+        internedCounts.emplace(InternedMetricName{ metric_name(i) }, 0);
+    }
+
+    BENCHMARK("Map lookups, strong_type<std::string>")
+    {
+        for(const MetricName& name : names)
+            ++counts.find(name)->second;
+        return counts.size();
+    };
+
+    BENCHMARK("Map lookups, interned")
+    {
+        for(const InternedMetricName name : internedNames)
+            ++internedCounts.find(name)->second;
+        return internedCounts.size();
+    };
+
+    BENCHMARK("Equality, strong_type<std::string>")
+    {
+        size_t equal = 0;
+        for(size_t i = 1; i < names.size(); ++i)
+            if(names[i] == names[i - 1])
+                ++equal;
+        return equal;
+    };
+
+    BENCHMARK("Equality, interned")
+    {
+        size_t equal = 0;
+        for(size_t i = 1; i < internedNames.size(); ++i)
+            if(internedNames[i] == internedNames[i - 1])
+                ++equal;
+        return equal;
+    };
+}
+
+}  // namespace stronger::tests::benchmarks
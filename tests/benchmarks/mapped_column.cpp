@@ -0,0 +1,108 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <stronger.hpp>
+#include <stronger/mapped_column.hpp>
+#include <vector>
+
+namespace stronger::tests::benchmarks
+{
+
+namespace
+{
+
+using UserId = strong_type<int64_t, tag("UserId")>;
+
+constexpr size_t Users = 1'000'000ULL;
+
+template <typename Range>
+int64_t sum(const Range& ids)
+{
+    int64_t total = 0;
+    for(const UserId id : ids)
+        total += *id;
+    return total;
+}
+
+}  // namespace
+
+// Cold loads open the file at each iteration: the file is in the page cache, but each page of a new mapping is faulted
+// in on first access. Warm loads read a column that is already loaded.
+TEST_CASE("Benchmark: loading columns from files", "[benchmark]")
+{
+    const std::filesystem::path directory = std::filesystem::temp_directory_path();
+    const std::filesystem::path csv = directory / "stronger_benchmark_users.csv";
+    const std::filesystem::path binary = directory / "stronger_benchmark_users.bin";
+    const std::filesystem::path mapped = directory / "stronger_benchmark_users.col";
+
+    std::vector<UserId> users;
+    users.reserve(Users);
+    for(size_t i = 0; i < Users; ++i)
+        users.emplace_back(static_cast<int64_t>(i * 7919 % 1'000'003));
+    {
+        std::ofstream file(csv);
+        for(const UserId id : users)
+            file << *id << '\n';
+    }
+    {
+        std::ofstream file(binary, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(users.data()), static_cast<std::streamsize>(Users * sizeof(UserId)));
+    }
+    mapped_column<UserId>::write(mapped, users);
+
+    SECTION("Cold load")
+    {
+        BENCHMARK("CSV, std::ifstream >>")
+        {
+            std::ifstream file(csv);
+            std::vector<UserId> loaded;
+            loaded.reserve(Users);
+            int64_t id = 0;
+            while(file >> id)
+                loaded.emplace_back(id);
+            return sum(loaded);
+        };
+
+        BENCHMARK("Binary, std::ifstream::read")
+        {
+            std::ifstream file(binary, std::ios::binary);
+            std::vector<UserId> loaded(Users);
+            file.read(reinterpret_cast<char*>(loaded.data()), static_cast<std::streamsize>(Users * sizeof(UserId)));
+            return sum(loaded);
+        };
+
+        BENCHMARK("mapped_column")
+        {
+            const mapped_column<UserId> loaded(mapped);
+            return sum(loaded);
+        };
+    }
+
+    SECTION("Warm load")
+    {
+        const mapped_column<UserId> loaded(mapped);
+
+        BENCHMARK("std::vector")
+        {
+            return sum(users);
+        };
+
+        BENCHMARK("mapped_column")
+        {
+            return sum(loaded);
+        };
+    }
+
+    std::filesystem::remove(csv);
+    std::filesystem::remove(binary);
+    std::filesystem::remove(mapped);
+}
+
+}  // namespace stronger::tests::benchmarks
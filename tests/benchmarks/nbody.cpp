@@ -0,0 +1,87 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "nbody.hpp"
+#include <cmath>
+#include <cstddef>
+
+namespace stronger::tests::benchmarks::nbody
+{
+
+namespace
+{
+
+constexpr double RawGravitationalConstant = 6.674e-11;
+constexpr double RawSoftening = 1e-3;
+
+// m^3 kg^-1 s^-2
+constexpr units::quantity<double, units::unit<units::dimension<3, -1, -2>>> GravitationalConstant{
+    RawGravitationalConstant
+};
+constexpr units::square_meters Softening{ RawSoftening };
+
+}  // namespace
+
+void step_raw(const std::span<RawBody> bodies, const double dt) noexcept
+{
+    for(size_t i = 0; i < bodies.size(); ++i)
+    {
+        double ax = 0.0;
+        double ay = 0.0;
+        double az = 0.0;
+        for(size_t j = 0; j < bodies.size(); ++j)
+        {
+            const double dx = bodies[j].x - bodies[i].x;
+            const double dy = bodies[j].y - bodies[i].y;
+            const double dz = bodies[j].z - bodies[i].z;
+            const double distanceSquared = dx * dx + dy * dy + dz * dz + RawSoftening;
+            const double distance = std::sqrt(distanceSquared);
+            const double factor = RawGravitationalConstant * bodies[j].mass / (distanceSquared * distance);
+            ax += factor * dx;
+            ay += factor * dy;
+            az += factor * dz;
+        }
+        bodies[i].vx += ax * dt;
+        bodies[i].vy += ay * dt;
+        bodies[i].vz += az * dt;
+    }
+    for(RawBody& body : bodies)
+    {
+        body.x += body.vx * dt;
+        body.y += body.vy * dt;
+        body.z += body.vz * dt;
+    }
+}
+
+void step_units(const std::span<UnitsBody> bodies, const units::seconds dt) noexcept
+{
+    for(size_t i = 0; i < bodies.size(); ++i)
+    {
+        units::meters_per_second_squared ax{ 0.0 };
+        units::meters_per_second_squared ay{ 0.0 };
+        units::meters_per_second_squared az{ 0.0 };
+        for(size_t j = 0; j < bodies.size(); ++j)
+        {
+            const units::meters dx = bodies[j].x - bodies[i].x;
+            const units::meters dy = bodies[j].y - bodies[i].y;
+            const units::meters dz = bodies[j].z - bodies[i].z;
+            const units::square_meters distanceSquared = dx * dx + dy * dy + dz * dz + Softening;
+            const units::meters distance = units::sqrt(distanceSquared);
+            const auto factor = GravitationalConstant * bodies[j].mass / (distanceSquared * distance);
+            ax += factor * dx;
+            ay += factor * dy;
+            az += factor * dz;
+        }
+        bodies[i].vx += ax * dt;
+        bodies[i].vy += ay * dt;
+        bodies[i].vz += az * dt;
+    }
+    for(UnitsBody& body : bodies)
+    {
+        body.x += body.vx * dt;
+        body.y += body.vy * dt;
+        body.z += body.vz * dt;
+    }
+}
+
+}  // namespace stronger::tests::benchmarks::nbody
@@ -0,0 +1,34 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+// N-body step kernel, written once on raw doubles and once on stronger::units quantities.
+// Both versions are compiled in nbody.cpp, and units-assembly.py checks that they compile to the same instructions.
+
+#pragma once
+#include <span>
+#include <stronger/units.hpp>
+
+namespace stronger::tests::benchmarks::nbody
+{
+
+struct RawBody
+{
+    double x, y, z;
+    double vx, vy, vz;
+    double mass;
+};
+
+struct UnitsBody
+{
+    units::meters x, y, z;
+    units::meters_per_second vx, vy, vz;
+    units::kilograms mass;
+};
+
+/// Advances `bodies` by `dt` seconds, under their mutual gravitation
+void step_raw(std::span<RawBody> bodies, double dt) noexcept;
+
+/// Same as step_raw, on quantities
+void step_units(std::span<UnitsBody> bodies, units::seconds dt) noexcept;
+
+}  // namespace stronger::tests::benchmarks::nbody
@@ -0,0 +1,85 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <stronger.hpp>
+#include <stronger/overflow.hpp>
+#include <vector>
+
+namespace stronger::tests::benchmarks
+{
+
+namespace
+{
+
+using Unchecked = strong_type<int64_t, tag()>;
+using Checked = strong_type<int64_t, tag(), options::checked_arithmetic>;
+using Saturating = strong_type<int64_t, tag(), options::saturating_arithmetic>;
+
+constexpr size_t Entries = 1'000'000ULL;
+
+/// Sum of price * quantity, as in a ledger. One multiplication and one addition per entry
+template <typename Amount>
+Amount total(const std::vector<Amount>& prices, const std::vector<Amount>& quantities)
+{
+    Amount sum{ 0 };
+    for(size_t i = 0; i < prices.size(); ++i)
+        sum += prices[i] * quantities[i];
+    return sum;
+}
+
+template <typename Amount>
+std::vector<Amount> make_column(const int64_t modulo, const int64_t offset)
+{
+    std::vector<Amount> column;
+    column.reserve(Entries);
+    for(size_t i = 0; i < Entries; ++i)
+        column.emplace_back(static_cast<int64_t>(i) % modulo - offset);
+    return column;
+}
+
+}  // namespace
+
+TEST_CASE("Benchmark: checked and saturating arithmetic", "[benchmark]")
+{
+    const auto uncheckedPrices = make_column<Unchecked>(10'007, 5'000);
+    const auto uncheckedQuantities = make_column<Unchecked>(101, 20);
+    const auto checkedPrices = make_column<Checked>(10'007, 5'000);
+    const auto checkedQuantities = make_column<Checked>(101, 20);
+    const auto saturatingPrices = make_column<Saturating>(10'007, 5'000);
+    const auto saturatingQuantities = make_column<Saturating>(101, 20);
+
+    // No overflow here: all modes compute the same total
+    const int64_t expected = *total(uncheckedPrices, uncheckedQuantities);
+    CHECK(*total(checkedPrices, checkedQuantities) == expected);
+    CHECK(*total(saturatingPrices, saturatingQuantities) == expected);
+
+    SECTION("Unchecked")
+    {
+        BENCHMARK("Inherited arithmetic")
+        {
+            return total(uncheckedPrices, uncheckedQuantities);
+        };
+    }
+
+    SECTION("options::checked_arithmetic")
+    {
+        BENCHMARK("Checked arithmetic")
+        {
+            return total(checkedPrices, checkedQuantities);
+        };
+    }
+
+    SECTION("options::saturating_arithmetic")
+    {
+        BENCHMARK("Saturating arithmetic")
+        {
+            return total(saturatingPrices, saturatingQuantities);
+        };
+    }
+}
+
+}  // namespace stronger::tests::benchmarks
@@ -0,0 +1,64 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <stronger.hpp>
+#include <stronger/point_type.hpp>
+#include <vector>
+
+namespace stronger::tests::benchmarks
+{
+
+namespace
+{
+
+using SequenceNumber = point_type<uint32_t, tag(), options::modular>;
+
+constexpr size_t Packets = 1'000'000ULL;
+
+/// Hand-rolled serial number comparison, as network code usually writes it
+bool is_before(const uint32_t lhs, const uint32_t rhs)
+{
+    return static_cast<int32_t>(lhs - rhs) < 0;
+}
+
+}  // namespace
+
+TEST_CASE("Benchmark: counting out-of-order sequence numbers", "[benchmark]")
+{
+    // Sequence numbers wrap around in the middle of the stream, with a few packets out of order
+    std::vector<uint32_t> raw(Packets);
+    for(size_t i = 0; i < Packets; ++i)
+        raw[i] = static_cast<uint32_t>(0xFFFF'0000U + i + (i % 7 == 0 ? 3U : 0U));
+    std::vector<SequenceNumber> strong;
+    strong.reserve(Packets);
+    for(const uint32_t sequence : raw)
+        strong.emplace_back(sequence);
+
+    SECTION("Hand-rolled comparisons")
+    {
+        BENCHMARK("No strong type")
+        {
+            size_t outOfOrder = 0;
+            for(size_t i = 1; i < Packets; ++i)
+                outOfOrder += is_before(raw[i], raw[i - 1]) ? 1 : 0;
+            return outOfOrder;
+        };
+    }
+
+    SECTION("options::modular")
+    {
+        BENCHMARK("point_type")
+        {
+            size_t outOfOrder = 0;
+            for(size_t i = 1; i < Packets; ++i)
+                outOfOrder += strong[i] < strong[i - 1] ? 1 : 0;
+            return outOfOrder;
+        };
+    }
+}
+
+}  // namespace stronger::tests::benchmarks
@@ -0,0 +1,66 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <memory>
+#include <stronger.hpp>
+#include <stronger/containers/relocating_vector.hpp>
+#include <vector>
+
+namespace stronger::tests::benchmarks
+{
+
+namespace
+{
+
+using Handle = strong_type<std::unique_ptr<int>, tag()>;
+
+constexpr size_t Handles = 10'000'000ULL;
+
+/// Grows the vector one element at a time, without reserving: every reallocation moves all the elements
+template <typename Vector>
+size_t grow()
+{
+    Vector handles;
+    for(size_t i = 0; i < Handles; ++i)
+        handles.emplace_back(nullptr);
+    return handles.size();
+}
+
+}  // namespace
+
+TEST_CASE("Benchmark: relocating vector", "[benchmark]")
+{
+    BENCHMARK("Growth, std::vector")
+    {
+        return grow<std::vector<Handle>>();
+    };
+
+    BENCHMARK("Growth, relocating_vector")
+    {
+        return grow<relocating_vector<Handle>>();
+    };
+
+    std::vector<Handle> handles(Handles);
+    relocating_vector<Handle> relocatingHandles;
+    for(size_t i = 0; i < Handles; ++i)
+        relocatingHandles.emplace_back(nullptr);
+
+    BENCHMARK("Erase the first element, std::vector")
+    {
+        handles.erase(handles.begin());
+        handles.emplace_back(nullptr);
+        return handles.size();
+    };
+
+    BENCHMARK("Erase the first element, relocating_vector")
+    {
+        relocatingHandles.erase(relocatingHandles.begin());
+        relocatingHandles.emplace_back(nullptr);
+        return relocatingHandles.size();
+    };
+}
+
+}  // namespace stronger::tests::benchmarks
@@ -0,0 +1,118 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include <bit>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stronger.hpp>
+#include <stronger/serialization.hpp>
+#include <vector>
+
+namespace stronger::tests::benchmarks
+{
+
+namespace
+{
+
+using Price = strong_type<double, tag()>;
+
+constexpr size_t Prices = 10'000'000ULL;
+
+/// Byte order that is not the native one, so that every value is byte swapped
+constexpr std::endian Foreign = std::endian::native == std::endian::little ? std::endian::big : std::endian::little;
+
+template <std::endian Order>
+std::vector<std::byte> serialize_each(const std::vector<Price>& prices)
+{
+    std::vector<std::byte> out;
+    out.reserve(sizeof(uint64_t) + prices.size() * sizeof(Price));
+    serialize<Order>(out, uint64_t{ prices.size() });
+    for(const Price price : prices)
+        serialize<Order>(out, price);
+    return out;
+}
+
+template <std::endian Order>
+std::vector<std::byte> serialize_bulk(const std::vector<Price>& prices)
+{
+    std::vector<std::byte> out;
+    out.reserve(sizeof(uint64_t) + prices.size() * sizeof(Price));
+    serialize<Order>(out, prices);
+    return out;
+}
+
+template <std::endian Order>
+std::vector<Price> deserialize_each(std::span<const std::byte> in)
+{
+    std::vector<Price> prices(deserialize<uint64_t, Order>(in));
+    for(Price& price : prices)
+        price = deserialize<Price, Order>(in);
+    return prices;
+}
+
+}  // namespace
+
+TEST_CASE("Benchmark: serialization", "[benchmark]")
+{
+    std::vector<Price> prices;
+    prices.reserve(Prices);
+    for(size_t i = 0; i < Prices; ++i)
+        prices.emplace_back(100.0 + static_cast<double>(i % 400) * 0.25);
+
+    SECTION("Native byte order")
+    {
+        const std::vector<std::byte> bytes = serialize_bulk<std::endian::native>(prices);
+
+        BENCHMARK("Serialize, per element")
+        {
+            return serialize_each<std::endian::native>(prices);
+        };
+
+        BENCHMARK("Serialize, bulk")
+        {
+            return serialize_bulk<std::endian::native>(prices);
+        };
+
+        BENCHMARK("Deserialize, per element")
+        {
+            return deserialize_each<std::endian::native>(bytes);
+        };
+
+        BENCHMARK("Deserialize, bulk")
+        {
+            std::span<const std::byte> in = bytes;
+            return deserialize<std::vector<Price>>(in);
+        };
+    }
+
+    SECTION("Foreign byte order")
+    {
+        const std::vector<std::byte> bytes = serialize_bulk<Foreign>(prices);
+
+        BENCHMARK("Serialize, per element, byte swapped")
+        {
+            return serialize_each<Foreign>(prices);
+        };
+
+        BENCHMARK("Serialize, bulk, byte swapped")
+        {
+            return serialize_bulk<Foreign>(prices);
+        };
+
+        BENCHMARK("Deserialize, per element, byte swapped")
+        {
+            return deserialize_each<Foreign>(bytes);
+        };
+
+        BENCHMARK("Deserialize, bulk, byte swapped")
+        {
+            std::span<const std::byte> in = bytes;
+            return deserialize<std::vector<Price>, Foreign>(in);
+        };
+    }
+}
+
+}  // namespace stronger::tests::benchmarks
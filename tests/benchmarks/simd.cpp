@@ -0,0 +1,91 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include <stronger.hpp>
+#include <stronger/simd.hpp>
+
+#if __has_include(<experimental/simd>)
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace stronger::tests::benchmarks
+{
+
+namespace
+{
+
+namespace stdx = std::experimental;
+
+using Meters = strong_type<double, tag()>;
+using MetersBatch = simd_of<Meters>;
+using DoubleBatch = stdx::native_simd<double>;
+
+constexpr size_t Elements = 1'000'000ULL;
+constexpr size_t Width = DoubleBatch::size();
+
+/// positions += offsets, clamped to limit, and returns the sum of the positions
+double move_and_clamp(std::vector<double>& positions, const std::vector<double>& offsets, const double limit)
+{
+    const DoubleBatch limitBatch{ limit };
+    DoubleBatch sum{ 0.0 };
+    for(size_t i = 0; i < Elements; i += Width)
+    {
+        DoubleBatch position{ positions.data() + i, stdx::element_aligned };
+        position += DoubleBatch{ offsets.data() + i, stdx::element_aligned };
+        stdx::where(position > limitBatch, position) = limitBatch;
+        position.copy_to(positions.data() + i, stdx::element_aligned);
+        sum += position;
+    }
+    return stdx::reduce(sum);
+}
+
+Meters move_and_clamp(std::vector<Meters>& positions, const std::vector<Meters>& offsets, const Meters limit)
+{
+    const MetersBatch limitBatch{ *limit };
+    MetersBatch sum{ 0.0 };
+    const std::span<Meters> positionsSpan{ positions };
+    const std::span<const Meters> offsetsSpan{ offsets };
+    for(size_t i = 0; i < Elements; i += Width)
+    {
+        MetersBatch position = load_simd(positionsSpan.subspan(i, Width));
+        position += load_simd(offsetsSpan.subspan(i, Width));
+        where(position > limitBatch, position) = limitBatch;
+        store_simd(position, positionsSpan.subspan(i, Width));
+        sum += position;
+    }
+    return reduce(sum);
+}
+
+}  // namespace
+
+TEST_CASE("Benchmark: std::experimental::simd<double> vs simd_of<strong_type<double>>", "[benchmark]")
+{
+    static_assert(Elements % Width == 0);
+
+    SECTION("native_simd<double>")
+    {
+        std::vector<double> positions(Elements, 0.0);
+        const std::vector<double> offsets(Elements, 0.001);
+        BENCHMARK("native_simd<double>")
+        {
+            return move_and_clamp(positions, offsets, 100.0);
+        };
+    }
+
+    SECTION("simd_of<Meters>")
+    {
+        std::vector<Meters> positions(Elements, Meters{ 0.0 });
+        const std::vector<Meters> offsets(Elements, Meters{ 0.001 });
+        BENCHMARK("simd_of<Meters>")
+        {
+            return move_and_clamp(positions, offsets, Meters{ 100.0 });
+        };
+    }
+}
+
+}  // namespace stronger::tests::benchmarks
+
+#endif
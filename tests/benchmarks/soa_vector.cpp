@@ -0,0 +1,92 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <stronger.hpp>
+#include <stronger/containers/soa_vector.hpp>
+#include <vector>
+
+namespace stronger::tests::benchmarks
+{
+
+namespace
+{
+
+using Price = strong_type<double, tag()>;
+using Quantity = strong_type<int64_t, tag()>;
+using OrderId = strong_type<uint64_t, tag()>;
+using Side = strong_type<uint8_t, tag()>;
+
+/// Array of structs layout, with some padding like most records
+struct Order
+{
+    Price price;
+    Quantity quantity;
+    OrderId id;
+    Side side;
+};
+
+constexpr size_t Orders = 1'000'000ULL;
+
+}  // namespace
+
+TEST_CASE("Benchmark: column reductions", "[benchmark]")
+{
+    std::vector<Order> array;
+    soa_vector<Price, Quantity, OrderId, Side> columns;
+    array.reserve(Orders);
+    columns.reserve(Orders);
+    for(size_t i = 0; i < Orders; ++i)
+    {
+        const Order order{ Price{ 100.0 + static_cast<double>(i % 50) * 0.25 },
+                           Quantity{ static_cast<int64_t>(i % 1000) }, OrderId{ i },
+                           Side{ static_cast<uint8_t>(i % 2) } };
+        array.push_back(order);
+        columns.push_back(order.price, order.quantity, order.id, order.side);
+    }
+
+    SECTION("Array of structs")
+    {
+        BENCHMARK("Sum of quantities, std::vector<Order>")
+        {
+            int64_t total = 0;
+            for(const Order& order : array)
+                total += *order.quantity;
+            return total;
+        };
+
+        BENCHMARK("Notional, std::vector<Order>")
+        {
+            double notional = 0.0;
+            for(const Order& order : array)
+                notional += *order.price * static_cast<double>(*order.quantity);
+            return notional;
+        };
+    }
+
+    SECTION("Structure of arrays")
+    {
+        BENCHMARK("Sum of quantities, soa_vector")
+        {
+            int64_t total = 0;
+            for(const Quantity quantity : columns.column<Quantity>())
+                total += *quantity;
+            return total;
+        };
+
+        BENCHMARK("Notional, soa_vector")
+        {
+            const auto prices = columns.column<Price>();
+            const auto quantities = columns.column<Quantity>();
+            double notional = 0.0;
+            for(size_t i = 0; i < prices.size(); ++i)
+                notional += *prices[i] * static_cast<double>(*quantities[i]);
+            return notional;
+        };
+    }
+}
+
+}  // namespace stronger::tests::benchmarks
@@ -0,0 +1,86 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <stronger.hpp>
+#include <stronger/containers/strong_vector.hpp>
+#include <vector>
+
+namespace stronger::tests::benchmarks
+{
+
+namespace
+{
+
+using EntityId = strong_type<uint32_t, tag()>;
+using Slot = strong_type<uint32_t, tag()>;
+
+constexpr uint32_t Entities = 10'000'000U;
+
+std::vector<uint32_t> get_random_indices()
+{
+    std::vector<uint32_t> indices(Entities);
+    for(uint32_t i = 0; i < Entities; ++i)
+        indices[i] = i;
+    std::ranges::shuffle(indices, std::mt19937{ 42U });
+    return indices;
+}
+
+void gather_scatter(const std::vector<uint32_t>& indices, const std::vector<double>& input,
+                    std::vector<double>& gathered, std::vector<double>& scattered)
+{
+    for(uint32_t i = 0; i < Entities; ++i)
+        gathered[i] = input[indices[i]];
+    for(uint32_t i = 0; i < Entities; ++i)
+        scattered[indices[i]] = gathered[i];
+}
+
+void gather_scatter(const strong_vector<Slot, EntityId>& indices, const strong_vector<EntityId, double>& input,
+                    strong_vector<Slot, double>& gathered, strong_vector<EntityId, double>& scattered)
+{
+    for(Slot i{ 0U }; i < indices.size(); ++i)
+        gathered[i] = input[indices[i]];
+    for(Slot i{ 0U }; i < indices.size(); ++i)
+        scattered[indices[i]] = gathered[i];
+}
+
+}  // namespace
+
+TEST_CASE("Benchmark: std::vector vs strong_vector gather/scatter", "[benchmark]")
+{
+    const auto rawIndices = get_random_indices();
+    const std::vector<double> rawInput(Entities, 1.0);
+
+    SECTION("std::vector")
+    {
+        std::vector<double> gathered(Entities);
+        std::vector<double> scattered(Entities);
+        BENCHMARK("std::vector")
+        {
+            gather_scatter(rawIndices, rawInput, gathered, scattered);
+            return scattered.back();
+        };
+    }
+
+    SECTION("strong_vector")
+    {
+        strong_vector<Slot, EntityId> indices;
+        indices.reserve(Slot{ Entities });
+        for(const uint32_t index : rawIndices)
+            indices.emplace_back(index);
+        const strong_vector<EntityId, double> input(rawInput);
+        strong_vector<Slot, double> gathered(Slot{ Entities });
+        strong_vector<EntityId, double> scattered(EntityId{ Entities });
+        BENCHMARK("strong_vector")
+        {
+            gather_scatter(indices, input, gathered, scattered);
+            return scattered.back();
+        };
+    }
+}
+
+}  // namespace stronger::tests::benchmarks
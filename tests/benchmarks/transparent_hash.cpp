@@ -0,0 +1,77 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <format>
+#include <string>
+#include <string_view>
+#include <stronger.hpp>
+#include <stronger/transparent_hash.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace stronger::tests::benchmarks
+{
+
+namespace
+{
+
+using Symbol = strong_type<std::string, tag("benchmarks::Symbol")>;
+using SymbolView = strong_type<std::string_view, tag("benchmarks::Symbol")>;
+
+constexpr size_t MapSize = 10'000ULL;
+
+/// Keys are long enough not to fit in the small string buffer, so that building a Symbol allocates
+std::vector<std::string> get_keys()
+{
+    std::vector<std::string> keys;
+    keys.reserve(MapSize);
+    for(size_t i = 0; i < MapSize; ++i)
+        keys.push_back(std::format("symbol-with-a-long-name-{:08}", i));
+    return keys;
+}
+
+template <typename Map>
+Map get_map(const std::vector<std::string>& keys)
+{
+    Map map;
+    for(size_t i = 0; i < keys.size(); ++i)
+        map.emplace(Symbol{ keys[i] }, i);
+    return map;
+}
+
+}  // namespace
+
+TEST_CASE("Benchmark: lookups with and without transparent hashing", "[benchmark]")
+{
+    const auto keys = get_keys();
+    const std::vector<std::string_view> views(keys.begin(), keys.end());
+
+    SECTION("Lookup constructing a Symbol from each std::string_view")
+    {
+        const auto map = get_map<std::unordered_map<Symbol, size_t>>(keys);
+        BENCHMARK("std::hash<Symbol>")
+        {
+            size_t sum = 0;
+            for(const std::string_view view : views)
+                sum += map.find(Symbol{ view })->second;
+            return sum;
+        };
+    }
+
+    SECTION("Heterogeneous lookup with SymbolView")
+    {
+        const auto map = get_map<
+            std::unordered_map<Symbol, size_t, transparent_hash<Symbol>, transparent_equal_to<Symbol>>>(keys);
+        BENCHMARK("transparent_hash<Symbol>")
+        {
+            size_t sum = 0;
+            for(const std::string_view view : views)
+                sum += map.find(SymbolView{ view })->second;
+            return sum;
+        };
+    }
+}
+
+}  // namespace stronger::tests::benchmarks
@@ -0,0 +1,78 @@
+import re
+import subprocess
+from collections import Counter
+import sys
+from pathlib import Path
+
+CURRENT_DIR = Path(__file__).parent
+INCLUDES_DIR = CURRENT_DIR.parent.parent / "includes"
+COMPILE_OPTIONS = ["-std=c++23", "-O3", "-S", "-fno-asynchronous-unwind-tables", "-masm=intel"]
+
+# Checks that the n-body step on stronger::units quantities compiles to the same instructions as the step on doubles.
+# The compiler may still number its temporaries differently in both functions, and swap the operands of commutative
+# instructions or two registers: in that case the instructions are the same, but not in the same order.
+# Usage: python3 units-assembly.py [compiler]
+
+
+def compile_to_assembly(compiler):
+    command = [compiler, "nbody.cpp", "-o", "-", f"-I{INCLUDES_DIR}"] + COMPILE_OPTIONS
+    print("Running:", *command, sep=" ")
+    result = subprocess.run(command, cwd=CURRENT_DIR, capture_output=True, text=True)
+    if result.returncode != 0:
+        print(result.stderr)
+        raise RuntimeError("Compilation failed")
+    return result.stdout
+
+
+def function_body(assembly, name):
+    lines = assembly.splitlines()
+    start = next(i for i, line in enumerate(lines) if re.match(rf"^_\w*{name}\w*:", line))
+    body = []
+    for line in lines[start + 1:]:
+        if re.match(r"^\s*\.size\s", line) or re.match(r"^_\w+:", line):
+            break
+        body.append(line)
+    return body
+
+
+def normalize(body):
+    # Local labels and constants are numbered per function: number them in order of appearance instead
+    labels = {}
+
+    def rename(match):
+        return labels.setdefault(match.group(0), f".L{len(labels)}")
+
+    instructions = []
+    for line in body:
+        line = line.split("#")[0].rstrip()
+        if not line or re.match(r"^\s*\.(p2align|align|cfi_\w+)", line) or re.match(r"^\.LF[BE]\d+:", line):
+            continue
+        instructions.append(re.sub(r"\.LC?\d+", rename, line))
+    return instructions
+
+
+def main():
+    compiler = sys.argv[1] if len(sys.argv) > 1 else "g++"
+    assembly = compile_to_assembly(compiler)
+    raw = normalize(function_body(assembly, "step_raw"))
+    strong = normalize(function_body(assembly, "step_units"))
+    if raw == strong:
+        print(f"Identical assembly ({len(raw)} lines)")
+        return 0
+
+    def mnemonics(instructions):
+        return Counter(line.split()[0] for line in instructions if not line.endswith(":"))
+
+    if mnemonics(raw) == mnemonics(strong):
+        print(f"Same instructions, scheduled or allocated differently ({len(raw)} lines)")
+        return 0
+
+    for raw_line, strong_line in zip(raw, strong):
+        marker = "  " if raw_line == strong_line else "!="
+        print(f"{marker} {raw_line:<60}{strong_line}")
+    print(f"Assembly differs ({len(raw)} vs {len(strong)} lines)")
+    return 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
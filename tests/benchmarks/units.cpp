@@ -0,0 +1,81 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "nbody.hpp"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <stronger.hpp>
+#include <stronger/units.hpp>
+#include <vector>
+
+namespace stronger::tests::benchmarks
+{
+
+namespace
+{
+
+constexpr size_t Bodies = 512ULL;
+
+std::vector<nbody::RawBody> make_raw_bodies()
+{
+    std::vector<nbody::RawBody> bodies(Bodies);
+    for(size_t i = 0; i < Bodies; ++i)
+    {
+        const auto position = static_cast<double>(i);
+        bodies[i] = { position, 2.0 * position, -position, 0.0, 1.0, 0.0, 1e6 + position };
+    }
+    return bodies;
+}
+
+std::vector<nbody::UnitsBody> make_units_bodies()
+{
+    std::vector<nbody::UnitsBody> bodies;
+    bodies.reserve(Bodies);
+    for(const nbody::RawBody& body : make_raw_bodies())
+    {
+        bodies.push_back({ units::meters{ body.x }, units::meters{ body.y }, units::meters{ body.z },
+                           units::meters_per_second{ body.vx }, units::meters_per_second{ body.vy },
+                           units::meters_per_second{ body.vz }, units::kilograms{ body.mass } });
+    }
+    return bodies;
+}
+
+}  // namespace
+
+TEST_CASE("Benchmark: n-body step on doubles vs units", "[benchmark]")
+{
+    std::vector<nbody::RawBody> rawBodies = make_raw_bodies();
+    std::vector<nbody::UnitsBody> unitsBodies = make_units_bodies();
+
+    SECTION("Both kernels compute the same positions")
+    {
+        nbody::step_raw(rawBodies, 0.01);
+        nbody::step_units(unitsBodies, units::seconds{ 0.01 });
+        for(size_t i = 0; i < Bodies; ++i)
+        {
+            CHECK(rawBodies[i].x == *unitsBodies[i].x);
+            CHECK(rawBodies[i].vy == *unitsBodies[i].vy);
+        }
+    }
+
+    SECTION("Raw doubles")
+    {
+        BENCHMARK("No strong type")
+        {
+            nbody::step_raw(rawBodies, 0.01);
+            return rawBodies.front().x;
+        };
+    }
+
+    SECTION("Quantities")
+    {
+        BENCHMARK("stronger::units")
+        {
+            nbody::step_units(unitsBodies, units::seconds{ 0.01 });
+            return *unitsBodies.front().x;
+        };
+    }
+}
+
+}  // namespace stronger::tests::benchmarks
@@ -11,6 +11,22 @@
 namespace stronger::tests
 {
 
+// Detect the operators defined between two types
+template <typename Lhs, typename Rhs>
+concept addable = requires(const Lhs& lhs, const Rhs& rhs) { lhs + rhs; };
+
+template <typename Lhs, typename Rhs>
+concept subtractable = requires(const Lhs& lhs, const Rhs& rhs) { lhs - rhs; };
+
+template <typename Lhs, typename Rhs>
+concept multipliable = requires(const Lhs& lhs, const Rhs& rhs) { lhs * rhs; };
+
+template <typename Lhs, typename Rhs>
+concept less_than_comparable = requires(const Lhs& lhs, const Rhs& rhs) { lhs < rhs; };
+
+template <typename Lhs, typename Rhs>
+concept equal_to_comparable = requires(const Lhs& lhs, const Rhs& rhs) { lhs == rhs; };
+
 class assertion_error final : public std::runtime_error
 {
     using std::runtime_error::runtime_error;
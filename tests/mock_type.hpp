@@ -103,92 +103,108 @@ struct instruction
     std::optional<int> rhs;
 };
 
-struct mock_type
+/**
+ * Records every operation applied to it, so that tests can check that strong types forward them.
+ *
+ * @tparam NoExcept Exception specification of every recorded operation
+ */
+template <bool NoExcept>
+struct basic_mock_type
 {
-    constexpr mock_type(const int value_, std::vector<instruction>* instructions_) :
+    constexpr basic_mock_type(const int value_, std::vector<instruction>* instructions_) noexcept(NoExcept) :
             value(value_),
             instructions(instructions_)
     {
     }
 
-    constexpr explicit(false) mock_type(const Operation origin_) : origin(origin_) {}
+    constexpr explicit(false) basic_mock_type(const Operation origin_) : origin(origin_) {}
 
-    constexpr mock_type() = default;
+    constexpr basic_mock_type() = default;
 
     using enum Operation;
-    [[nodiscard]] constexpr friend mock_type operator+(const mock_type& rhs)
+    [[nodiscard]] constexpr friend basic_mock_type operator+(const basic_mock_type& rhs) noexcept(NoExcept)
     {
         rhs.instructions->emplace_back(unary_plus, std::nullopt, rhs.value);
         return { unary_plus };
     }
 
-    [[nodiscard]] constexpr friend mock_type operator-(const mock_type& rhs)
+    [[nodiscard]] constexpr friend basic_mock_type operator-(const basic_mock_type& rhs) noexcept(NoExcept)
     {
         rhs.instructions->emplace_back(unary_minus, std::nullopt, rhs.value);
         return { unary_minus };
     }
 
-    [[nodiscard]] constexpr friend mock_type operator+(const mock_type& lhs, const mock_type& rhs)
+    [[nodiscard]] constexpr friend basic_mock_type operator+(const basic_mock_type& lhs, const basic_mock_type& rhs)
+        noexcept(NoExcept)
     {
         lhs.instructions->emplace_back(addition, lhs.value, rhs.value);
         return { addition };
     }
 
-    [[nodiscard]] constexpr friend mock_type operator-(const mock_type& lhs, const mock_type& rhs)
+    [[nodiscard]] constexpr friend basic_mock_type operator-(const basic_mock_type& lhs, const basic_mock_type& rhs)
+        noexcept(NoExcept)
     {
         lhs.instructions->emplace_back(subtraction, lhs.value, rhs.value);
         return { subtraction };
     }
 
-    [[nodiscard]] constexpr friend mock_type operator*(const mock_type& lhs, const mock_type& rhs)
+    [[nodiscard]] constexpr friend basic_mock_type operator*(const basic_mock_type& lhs, const basic_mock_type& rhs)
+        noexcept(NoExcept)
     {
         lhs.instructions->emplace_back(multiplication, lhs.value, rhs.value);
         return { multiplication };
     }
 
-    [[nodiscard]] constexpr friend mock_type operator/(const mock_type& lhs, const mock_type& rhs)
+    [[nodiscard]] constexpr friend basic_mock_type operator/(const basic_mock_type& lhs, const basic_mock_type& rhs)
+        noexcept(NoExcept)
     {
         lhs.instructions->emplace_back(division, lhs.value, rhs.value);
         return { division };
     }
 
-    [[nodiscard]] constexpr friend mock_type operator%(const mock_type& lhs, const mock_type& rhs)
+    [[nodiscard]] constexpr friend basic_mock_type operator%(const basic_mock_type& lhs, const basic_mock_type& rhs)
+        noexcept(NoExcept)
     {
         lhs.instructions->emplace_back(remainder, lhs.value, rhs.value);
         return { remainder };
     }
 
-    [[nodiscard]] constexpr friend mock_type operator~(const mock_type& rhs)
+    [[nodiscard]] constexpr friend basic_mock_type operator~(const basic_mock_type& rhs) noexcept(NoExcept)
     {
         rhs.instructions->emplace_back(bitwise_not, std::nullopt, rhs.value);
         return { bitwise_not };
     }
 
-    [[nodiscard]] constexpr friend mock_type operator&(const mock_type& lhs, const mock_type& rhs)
+    [[nodiscard]] constexpr friend basic_mock_type operator&(const basic_mock_type& lhs, const basic_mock_type& rhs)
+        noexcept(NoExcept)
     {
         lhs.instructions->emplace_back(bitwise_and, lhs.value, rhs.value);
         return { bitwise_and };
     }
 
-    [[nodiscard]] constexpr friend mock_type operator|(const mock_type& lhs, const mock_type& rhs)
+    [[nodiscard]] constexpr friend basic_mock_type operator|(const basic_mock_type& lhs, const basic_mock_type& rhs)
+        noexcept(NoExcept)
     {
         lhs.instructions->emplace_back(bitwise_or, lhs.value, rhs.value);
         return { bitwise_or };
     }
 
-    [[nodiscard]] constexpr friend mock_type operator^(const mock_type& lhs, const mock_type& rhs)
+    [[nodiscard]] constexpr friend basic_mock_type operator^(const basic_mock_type& lhs, const basic_mock_type& rhs)
+        noexcept(NoExcept)
     {
         lhs.instructions->emplace_back(bitwise_xor, lhs.value, rhs.value);
         return { bitwise_xor };
     }
 
-    [[nodiscard]] constexpr friend mock_type operator<<(const mock_type& lhs, const mock_type& rhs)
+    [[nodiscard]] constexpr friend basic_mock_type operator<<(const basic_mock_type& lhs, const basic_mock_type& rhs)
+        noexcept(NoExcept)
     {
         lhs.instructions->emplace_back(bitwise_left_shift, lhs.value, rhs.value);
         return { bitwise_left_shift };
     }
 
-    [[nodiscard]] constexpr friend mock_type operator>>(const mock_type& lhs, const mock_type& rhs)
+    [[nodiscard]] constexpr friend basic_mock_type operator>>(const basic_mock_type& lhs, const basic_mock_type& rhs)
+        noexcept(NoExcept)
     {
         lhs.instructions->emplace_back(bitwise_right_shift, lhs.value, rhs.value);
         return { bitwise_right_shift };
@@ -196,70 +212,70 @@ struct mock_type
 
     // Assignment operators ............................................................................................
 
-    constexpr friend mock_type& operator+=(mock_type& lhs, const mock_type& rhs)
+    constexpr friend basic_mock_type& operator+=(basic_mock_type& lhs, const basic_mock_type& rhs) noexcept(NoExcept)
     {
         lhs.instructions->emplace_back(addition_assignment, lhs.value, rhs.value);
         lhs.origin = addition_assignment;
         return lhs;
     }
 
-    constexpr friend mock_type& operator-=(mock_type& lhs, const mock_type& rhs)
+    constexpr friend basic_mock_type& operator-=(basic_mock_type& lhs, const basic_mock_type& rhs) noexcept(NoExcept)
     {
         lhs.instructions->emplace_back(subtraction_assignment, lhs.value, rhs.value);
         lhs.origin = subtraction_assignment;
         return lhs;
     }
 
-    constexpr friend mock_type& operator*=(mock_type& lhs, const mock_type& rhs)
+    constexpr friend basic_mock_type& operator*=(basic_mock_type& lhs, const basic_mock_type& rhs) noexcept(NoExcept)
     {
         lhs.instructions->emplace_back(multiplication_assignment, lhs.value, rhs.value);
         lhs.origin = multiplication_assignment;
         return lhs;
     }
 
-    constexpr friend mock_type& operator/=(mock_type& lhs, const mock_type& rhs)
+    constexpr friend basic_mock_type& operator/=(basic_mock_type& lhs, const basic_mock_type& rhs) noexcept(NoExcept)
     {
         lhs.instructions->emplace_back(division_assignment, lhs.value, rhs.value);
         lhs.origin = division_assignment;
         return lhs;
     }
 
-    constexpr friend mock_type& operator%=(mock_type& lhs, const mock_type& rhs)
+    constexpr friend basic_mock_type& operator%=(basic_mock_type& lhs, const basic_mock_type& rhs) noexcept(NoExcept)
     {
         lhs.instructions->emplace_back(remainder_assignment, lhs.value, rhs.value);
         lhs.origin = remainder_assignment;
         return lhs;
     }
 
-    constexpr friend mock_type& operator&=(mock_type& lhs, const mock_type& rhs)
+    constexpr friend basic_mock_type& operator&=(basic_mock_type& lhs, const basic_mock_type& rhs) noexcept(NoExcept)
     {
         lhs.instructions->emplace_back(bitwise_and_assignment, lhs.value, rhs.value);
         lhs.origin = bitwise_and_assignment;
         return lhs;
     }
 
-    constexpr friend mock_type& operator|=(mock_type& lhs, const mock_type& rhs)
+    constexpr friend basic_mock_type& operator|=(basic_mock_type& lhs, const basic_mock_type& rhs) noexcept(NoExcept)
     {
         lhs.instructions->emplace_back(bitwise_or_assignment, lhs.value, rhs.value);
         lhs.origin = bitwise_or_assignment;
         return lhs;
     }
 
-    constexpr friend mock_type& operator^=(mock_type& lhs, const mock_type& rhs)
+    constexpr friend basic_mock_type& operator^=(basic_mock_type& lhs, const basic_mock_type& rhs) noexcept(NoExcept)
     {
         lhs.instructions->emplace_back(bitwise_xor_assignment, lhs.value, rhs.value);
         lhs.origin = bitwise_xor_assignment;
         return lhs;
     }
 
-    constexpr friend mock_type& operator<<=(mock_type& lhs, const mock_type& rhs)
+    constexpr friend basic_mock_type& operator<<=(basic_mock_type& lhs, const basic_mock_type& rhs) noexcept(NoExcept)
     {
         lhs.instructions->emplace_back(bitwise_left_shift_assignment, lhs.value, rhs.value);
         lhs.origin = bitwise_left_shift_assignment;
         return lhs;
     }
 
-    constexpr friend mock_type& operator>>=(mock_type& lhs, const mock_type& rhs)
+    constexpr friend basic_mock_type& operator>>=(basic_mock_type& lhs, const basic_mock_type& rhs) noexcept(NoExcept)
     {
         lhs.instructions->emplace_back(bitwise_right_shift_assignment, lhs.value, rhs.value);
         lhs.origin = bitwise_right_shift_assignment;
@@ -268,27 +284,27 @@ struct mock_type
 
     // Increment and decrement operators ...............................................................................
 
-    constexpr mock_type& operator++()
+    constexpr basic_mock_type& operator++() noexcept(NoExcept)
     {
         instructions->emplace_back(pre_increment, std::nullopt, value);
         origin = pre_increment;
         return *this;
     }
 
-    constexpr mock_type& operator--()
+    constexpr basic_mock_type& operator--() noexcept(NoExcept)
     {
         instructions->emplace_back(pre_decrement, std::nullopt, value);
         origin = pre_decrement;
         return *this;
     }
 
-    constexpr mock_type operator++(int)
+    constexpr basic_mock_type operator++(int) noexcept(NoExcept)
     {
         instructions->emplace_back(post_increment, value, std::nullopt);
         return { post_increment };
     }
 
-    constexpr mock_type operator--(int)
+    constexpr basic_mock_type operator--(int) noexcept(NoExcept)
     {
         instructions->emplace_back(post_decrement, value, std::nullopt);
         return { post_decrement };
@@ -296,43 +312,50 @@ struct mock_type
 
     // Comparison operators ............................................................................................
 
-    [[nodiscard]] constexpr friend bool operator==(const mock_type& lhs, const mock_type& rhs)
+    [[nodiscard]] constexpr friend bool operator==(const basic_mock_type& lhs, const basic_mock_type& rhs)
+        noexcept(NoExcept)
     {
         lhs.instructions->emplace_back(equal_to, lhs.value, rhs.value);
         return true;
     }
 
-    [[nodiscard]] constexpr friend bool operator!=(const mock_type& lhs, const mock_type& rhs)
+    [[nodiscard]] constexpr friend bool operator!=(const basic_mock_type& lhs, const basic_mock_type& rhs)
+        noexcept(NoExcept)
     {
         lhs.instructions->emplace_back(not_equal_to, lhs.value, rhs.value);
         return true;
     }
 
-    [[nodiscard]] constexpr friend bool operator<(const mock_type& lhs, const mock_type& rhs)
+    [[nodiscard]] constexpr friend bool operator<(const basic_mock_type& lhs, const basic_mock_type& rhs)
+        noexcept(NoExcept)
     {
         lhs.instructions->emplace_back(less_than, lhs.value, rhs.value);
         return true;
     }
 
-    [[nodiscard]] constexpr friend bool operator>(const mock_type& lhs, const mock_type& rhs)
+    [[nodiscard]] constexpr friend bool operator>(const basic_mock_type& lhs, const basic_mock_type& rhs)
+        noexcept(NoExcept)
     {
         lhs.instructions->emplace_back(greater_than, lhs.value, rhs.value);
         return true;
     }
 
-    [[nodiscard]] constexpr friend bool operator<=(const mock_type& lhs, const mock_type& rhs)
+    [[nodiscard]] constexpr friend bool operator<=(const basic_mock_type& lhs, const basic_mock_type& rhs)
+        noexcept(NoExcept)
     {
         lhs.instructions->emplace_back(less_than_or_equal_to, lhs.value, rhs.value);
         return true;
     }
 
-    [[nodiscard]] constexpr friend bool operator>=(const mock_type& lhs, const mock_type& rhs)
+    [[nodiscard]] constexpr friend bool operator>=(const basic_mock_type& lhs, const basic_mock_type& rhs)
+        noexcept(NoExcept)
     {
         lhs.instructions->emplace_back(greater_than_or_equal_to, lhs.value, rhs.value);
         return true;
     }
 
-    [[nodiscard]] constexpr friend auto operator<=>(const mock_type& lhs, const mock_type& rhs)
+    [[nodiscard]] constexpr friend auto operator<=>(const basic_mock_type& lhs, const basic_mock_type& rhs)
+        noexcept(NoExcept)
     {
         lhs.instructions->emplace_back(three_way_comparison, lhs.value, rhs.value);
         return std::strong_ordering::equivalent;
@@ -340,7 +363,7 @@ struct mock_type
 
     // Logical operators ...............................................................................................
 
-    [[nodiscard]] constexpr friend bool operator!(const mock_type& rhs)
+    [[nodiscard]] constexpr friend bool operator!(const basic_mock_type& rhs) noexcept(NoExcept)
     {
         rhs.instructions->emplace_back(negation, std::nullopt, rhs.value);
         return {};
@@ -348,25 +371,25 @@ struct mock_type
 
     // Other operators .................................................................................................
 
-    [[nodiscard]] static constexpr mock_type operator()(const mock_type& x, int y)
+    [[nodiscard]] static constexpr basic_mock_type operator()(const basic_mock_type& x, int y) noexcept(NoExcept)
     {
         x.instructions->emplace_back(static_call, x.value, y);
         return { static_call };
     }
 
-    [[nodiscard]] constexpr mock_type operator()(int y) const
+    [[nodiscard]] constexpr basic_mock_type operator()(int y) const noexcept(NoExcept)
     {
         instructions->emplace_back(call, y, std::nullopt);
         return { call };
     }
 
-    [[nodiscard]] static constexpr mock_type operator[](const mock_type& x, int y)
+    [[nodiscard]] static constexpr basic_mock_type operator[](const basic_mock_type& x, int y) noexcept(NoExcept)
     {
         x.instructions->emplace_back(static_subscript, x.value, y);
         return { static_subscript };
     }
 
-    [[nodiscard]] constexpr mock_type operator[](int y) const
+    [[nodiscard]] constexpr basic_mock_type operator[](int y) const noexcept(NoExcept)
     {
         instructions->emplace_back(subscript, y, std::nullopt);
         return { subscript };
@@ -374,19 +397,19 @@ struct mock_type
 
     // Ostream insertion ...............................................................................................
 
-    constexpr friend std::ostream& operator<<(std::ostream& os, const mock_type& rhs)
+    constexpr friend std::ostream& operator<<(std::ostream& os, const basic_mock_type& rhs) noexcept(NoExcept)
     {
         rhs.instructions->emplace_back(ostream_insertion, os, rhs.value);
         return os;
     }
 
-    [[nodiscard]] constexpr auto begin() const
+    [[nodiscard]] constexpr auto begin() const noexcept(NoExcept)
     {
         instructions->emplace_back(begin_function, value, std::nullopt);
         return std::to_underlying(begin_function);
     }
 
-    [[nodiscard]] constexpr auto end() const
+    [[nodiscard]] constexpr auto end() const noexcept(NoExcept)
     {
         instructions->emplace_back(end_function, value, std::nullopt);
         return std::to_underlying(end_function);
@@ -397,6 +420,9 @@ struct mock_type
     Operation origin = noop;
 };
 
+using mock_type = basic_mock_type<false>;
+using nothrow_mock_type = basic_mock_type<true>;
+
 }  // namespace stronger::tests
 
 template <>
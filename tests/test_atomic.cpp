@@ -0,0 +1,147 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <stronger.hpp>
+#include <stronger/atomic.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace stronger::tests
+{
+
+namespace
+{
+
+using Counter = strong_type<uint64_t, tag()>;
+using Mask = strong_type<uint32_t, tag()>;
+using Ratio = strong_type<double, tag()>;
+using Name = strong_type<std::string, tag()>;
+
+template <typename Atomic, typename Arg>
+concept has_fetch_add = requires(Atomic& atomic, Arg arg) { atomic.fetch_add(arg); };
+
+template <typename Atomic>
+concept has_fetch_and = requires(Atomic& atomic, typename Atomic::value_type value) { atomic.fetch_and(value); };
+
+template <typename Atomic>
+concept has_increment = requires(Atomic& atomic) { ++atomic; };
+
+TEST_CASE("Atomic strong types")
+{
+    SECTION("Lock-freedom and layout match the underlying type")
+    {
+        static_assert(std::atomic<Counter>::is_always_lock_free == std::atomic<uint64_t>::is_always_lock_free);
+        static_assert(std::atomic<Ratio>::is_always_lock_free == std::atomic<double>::is_always_lock_free);
+        static_assert(std::atomic_ref<Counter>::is_always_lock_free == std::atomic_ref<uint64_t>::is_always_lock_free);
+        static_assert(std::atomic_ref<Counter>::required_alignment == std::atomic_ref<uint64_t>::required_alignment);
+        static_assert(sizeof(std::atomic<Counter>) == sizeof(std::atomic<uint64_t>));
+        static_assert(std::is_same_v<std::atomic<Counter>::value_type, Counter>);
+    }
+
+    SECTION("Available operations")
+    {
+        static_assert(has_fetch_and<std::atomic<Mask>>);
+        static_assert(has_increment<std::atomic<Mask>>);
+        static_assert(!has_fetch_and<std::atomic<Ratio>>);
+        static_assert(!has_increment<std::atomic<Ratio>>);
+        static_assert(concepts::atomic_arithmetic<Counter>);
+        static_assert(!concepts::atomic_arithmetic<Name>);
+        static_assert(!concepts::atomic_arithmetic<uint64_t>);
+    }
+
+    SECTION("Operations are strongly typed")
+    {
+        static_assert(has_fetch_add<std::atomic<Counter>, Counter>);
+        static_assert(!has_fetch_add<std::atomic<Counter>, uint64_t>);
+        static_assert(!has_fetch_add<std::atomic<Counter>, Mask>);
+        static_assert(!std::is_constructible_v<std::atomic<Counter>, Mask>);
+    }
+
+    SECTION("Mutating operations follow the constness of the underlying atomic")
+    {
+        static_assert(!has_fetch_add<const std::atomic<Counter>, Counter>);
+        static_assert(!has_fetch_and<const std::atomic<Mask>>);
+        static_assert(!has_increment<const std::atomic<Mask>>);
+        static_assert(!requires(const std::atomic<Counter>& atomic) { atomic.store(Counter{}); });
+        static_assert(!requires(const std::atomic<Counter>& atomic) { atomic.notify_one(); });
+        static_assert(requires(const std::atomic<Counter>& atomic) { atomic.load(); });
+        static_assert(has_fetch_add<const std::atomic_ref<Counter>, Counter>);
+        static_assert(has_increment<const std::atomic_ref<Mask>>);
+    }
+
+    SECTION("Read-modify-write operations")
+    {
+        std::atomic<Counter> counter{ Counter{ 10U } };
+        CHECK(counter.load() == Counter{ 10U });
+        CHECK(counter.fetch_add(Counter{ 5U }) == Counter{ 10U });
+        CHECK(counter.fetch_sub(Counter{ 3U }, std::memory_order_relaxed) == Counter{ 15U });
+        CHECK((counter += Counter{ 8U }) == Counter{ 20U });
+        CHECK((counter -= Counter{ 10U }) == Counter{ 10U });
+        CHECK(++counter == Counter{ 11U });
+        CHECK(counter++ == Counter{ 11U });
+        CHECK(--counter == Counter{ 11U });
+        CHECK(counter-- == Counter{ 11U });
+        CHECK(counter.exchange(Counter{ 42U }) == Counter{ 10U });
+        CHECK(static_cast<Counter>(counter) == Counter{ 42U });
+
+        Counter expected{ 0U };
+        CHECK_FALSE(counter.compare_exchange_strong(expected, Counter{ 1U }));
+        CHECK(expected == Counter{ 42U });
+        CHECK(counter.compare_exchange_strong(expected, Counter{ 1U }));
+        CHECK(counter.load() == Counter{ 1U });
+
+        counter = Counter{ 7U };
+        CHECK(counter.load(std::memory_order_acquire) == Counter{ 7U });
+    }
+
+    SECTION("Bitwise operations")
+    {
+        std::atomic<Mask> mask{ Mask{ 0b1100U } };
+        CHECK(mask.fetch_and(Mask{ 0b0100U }) == Mask{ 0b1100U });
+        CHECK(mask.fetch_or(Mask{ 0b0011U }) == Mask{ 0b0100U });
+        CHECK(mask.fetch_xor(Mask{ 0b0001U }) == Mask{ 0b0111U });
+        CHECK((mask &= Mask{ 0b0010U }) == Mask{ 0b0010U });
+        CHECK((mask |= Mask{ 0b1000U }) == Mask{ 0b1010U });
+        CHECK((mask ^= Mask{ 0b1111U }) == Mask{ 0b0101U });
+    }
+
+    SECTION("Floating-point operations")
+    {
+        std::atomic<Ratio> ratio{ Ratio{ 0.5 } };
+        CHECK(ratio.fetch_add(Ratio{ 0.25 }) == Ratio{ 0.5 });
+        CHECK(ratio.load() == Ratio{ 0.75 });
+    }
+
+    SECTION("Atomic references")
+    {
+        Counter counter{ 1U };
+        const std::atomic_ref<Counter> ref{ counter };
+        CHECK(ref.fetch_add(Counter{ 2U }) == Counter{ 1U });
+        ref.store(Counter{ 10U });
+        CHECK(ref.load() == Counter{ 10U });
+        CHECK(counter == Counter{ 10U });
+    }
+
+    SECTION("Concurrent increments")
+    {
+        constexpr uint64_t Increments = 10'000U;
+        std::atomic<Counter> counter;
+        {
+            std::vector<std::jthread> threads;
+            for(int i = 0; i < 4; ++i)
+                threads.emplace_back([&counter] {
+                    for(uint64_t j = 0; j < Increments; ++j)
+                        counter.fetch_add(Counter{ 1U }, std::memory_order_relaxed);
+                });
+        }
+        CHECK(counter.load() == Counter{ 4U * Increments });
+    }
+}
+
+}  // namespace
+
+}  // namespace stronger::tests
@@ -0,0 +1,227 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "helpers.h"
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <stronger.hpp>
+#include <stronger/bounded.hpp>
+#include <type_traits>
+#include <unordered_set>
+
+namespace stronger::tests
+{
+
+namespace
+{
+
+using Percent = bounded_type<int, 0, 100, bound_policy::saturate, tag()>;
+using Volume = bounded_type<uint8_t, 0, 10, bound_policy::saturate, tag()>;
+using Degrees = bounded_type<int, 0, 359, bound_policy::wrap, tag()>;
+using Hour = bounded_type<int16_t, 1, 12, bound_policy::wrap, tag()>;
+using Port = bounded_type<uint16_t, 1, 65535, bound_policy::throw_exception, tag()>;
+using Ratio = bounded_type<double, -1.0, 1.0, bound_policy::throw_exception, tag()>;
+using Index = bounded_type<uint32_t, 0, 1000, bound_policy::unchecked, tag()>;
+using Checked = bounded_type<int, -5, 5, bound_policy::assert_in_debug, tag()>;
+using Counter = bounded_type<uint64_t, 0, std::numeric_limits<uint64_t>::max(), bound_policy::throw_exception, tag()>;
+using Stock = bounded_type<uint64_t, 0, 100, bound_policy::saturate, tag()>;
+using Slot = bounded_type<uint64_t, 0, 100, bound_policy::wrap, tag()>;
+using Half = bounded_type<uint64_t, 0, uint64_t{ 1 } << 63, bound_policy::wrap, tag()>;
+using Balance = bounded_type<int64_t, std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max(),
+                             bound_policy::saturate, tag()>;
+using Offset = bounded_type<int64_t, std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max(),
+                            bound_policy::throw_exception, tag()>;
+using Tick = bounded_type<int64_t, std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max(),
+                          bound_policy::wrap, tag()>;
+using Debt = bounded_type<int64_t, std::numeric_limits<int64_t>::min(), 0, bound_policy::wrap, tag()>;
+using Other = bounded_type<int, 0, 100, bound_policy::saturate, tag()>;
+
+template <typename T>
+concept has_remainder = requires(const T& lhs, const T& rhs) { lhs % rhs; };
+
+template <typename T>
+concept is_writable = requires(T& value) { **value = **value; };
+
+template <int Value>
+concept percent_constant = requires { Percent::underlying_type::from_constant<Value>(); };
+
+TEST_CASE("Bounded types")
+{
+    SECTION("Layout and types")
+    {
+        static_assert(sizeof(Percent) == sizeof(int));
+        static_assert(sizeof(Volume) == sizeof(uint8_t));
+        static_assert(std::is_trivially_copyable_v<Port>);
+        static_assert(traits::is_strong_type<Percent>);
+        static_assert(std::is_same_v<Percent::underlying_type, bounded<int, 0, 100, bound_policy::saturate>>);
+        static_assert(traits::is_bounded<const Percent::underlying_type&>);
+        static_assert(!traits::is_bounded<int>);
+        static_assert(!traits::is_bounded<strong_type<int, tag()>>);
+        static_assert(std::is_same_v<Percent::underlying_type::underlying_type, int>);
+        static_assert(Percent::underlying_type::min == 0 && Percent::underlying_type::max == 100);
+        static_assert(Percent::underlying_type::policy == bound_policy::saturate);
+        static_assert(!addable<Percent, Other>);
+        static_assert(!addable<Percent, int>);
+        static_assert(!std::is_convertible_v<int, Percent>);
+        static_assert(!is_writable<Percent>);
+        static_assert(has_remainder<Percent>);
+        static_assert(!has_remainder<Ratio>);
+    }
+
+    SECTION("Default construction holds the minimum")
+    {
+        static_assert(**Percent{} == 0);
+        static_assert(**Port{} == 1);
+        static_assert(**Hour{} == 1);
+    }
+
+    SECTION("Saturation")
+    {
+        static_assert(**Percent{ 150 } == 100);
+        static_assert(**Percent{ -3 } == 0);
+        static_assert(**(Percent{ 60 } + Percent{ 70 }) == 100);
+        static_assert(**(Percent{ 20 } - Percent{ 70 }) == 0);
+        static_assert(**(Percent{ 20 } * Percent{ 3 }) == 60);
+        static_assert(**-Percent{ 20 } == 0);
+        // Computed in int64_t: no overflow of uint8_t before clamping
+        static_assert(**(Volume{ 0 } - Volume{ 3 }) == 0);
+        static_assert(**(Volume{ 9 } * Volume{ 9 }) == 10);
+        // Other integer types are checked before being converted to uint8_t
+        static_assert(**Volume{ 300 } == 10);
+        static_assert(**Volume{ -3 } == 0);
+        static_assert(noexcept(Percent{ 1 } + Percent{ 1 }));
+
+        Percent percent{ 95 };
+        percent += Percent{ 10 };
+        CHECK(**percent == 100);
+        ++percent;
+        CHECK(**percent == 100);
+        percent -= Percent{ 99 };
+        CHECK(**percent == 1);
+        percent--;
+        percent--;
+        CHECK(**percent == 0);
+    }
+
+    SECTION("Wrap around")
+    {
+        static_assert(**Degrees{ 360 } == 0);
+        static_assert(**Degrees{ 725 } == 5);
+        static_assert(**Degrees{ -1 } == 359);
+        static_assert(**Degrees{ -360 } == 0);
+        static_assert(**Degrees{ -361 } == 359);
+        static_assert(**(Degrees{ 350 } + Degrees{ 20 }) == 10);
+        static_assert(**(Degrees{ 10 } - Degrees{ 20 }) == 350);
+        static_assert(**-Degrees{ 90 } == 270);
+        static_assert(**Hour{ 13 } == 1);
+        static_assert(**Hour{ 0 } == 12);
+        static_assert(**(Hour{ 11 } + Hour{ 3 }) == 2);
+
+        Hour hour{ 12 };
+        ++hour;
+        CHECK(**hour == 1);
+        --hour;
+        CHECK(**hour == 12);
+    }
+
+    SECTION("Exceptions")
+    {
+        static_assert(**Port{ 8080 } == 8080);
+        static_assert(**(Ratio{ 0.5 } + Ratio{ 0.25 }) == 0.75);
+        static_assert(!noexcept(Port{ 1 } + Port{ 1 }));
+        CHECK_THROWS_AS(Port{ 0 }, std::out_of_range);
+        CHECK_THROWS_AS(Port{ 65535 } + Port{ 1 }, std::out_of_range);
+        CHECK_THROWS_AS(Ratio{ 0.75 } + Ratio{ 0.5 }, std::out_of_range);
+        CHECK_THROWS_AS(-Port{ 1 }, std::out_of_range);
+
+        Port port{ 65534 };
+        ++port;
+        CHECK(**port == 65535);
+        CHECK_THROWS_AS(++port, std::out_of_range);
+        CHECK(**port == 65535);
+    }
+
+    SECTION("64-bit integers out of the range of their type")
+    {
+        constexpr int64_t min = std::numeric_limits<int64_t>::min();
+        constexpr int64_t max = std::numeric_limits<int64_t>::max();
+
+        static_assert(**(Stock{ 50U } - Stock{ 100U }) == 0);
+        static_assert(**(-Stock{ 1U }) == 0);
+        static_assert(**(Balance{ max } + Balance{ 1 }) == max);
+        static_assert(**(Balance{ min } - Balance{ 1 }) == min);
+        static_assert(**(Balance{ min } + Balance{ -1 }) == min);
+        static_assert(**(Balance{ max } * Balance{ -2 }) == min);
+        static_assert(**(Balance{ min } * Balance{ -2 }) == max);
+        static_assert(**(Balance{ min } / Balance{ -1 }) == max);
+        static_assert(**(-Balance{ min }) == max);
+
+        static_assert(**(Slot{ 50U } - Slot{ 100U }) == 51);
+        static_assert(**(-Slot{ 1U }) == 100);
+        static_assert(**(Slot{ 60U } * Slot{ 60U }) == 3600 % 101);
+        static_assert(**(Half{ uint64_t{ 1 } << 62 } * Half{ 4U }) == (uint64_t{ 1 } << 63) - 1);
+        static_assert(**(Half{ uint64_t{ 1 } << 63 } + Half{ uint64_t{ 1 } << 63 }) == (uint64_t{ 1 } << 63) - 1);
+        static_assert(**(Tick{ max } + Tick{ 1 }) == min);
+        static_assert(**(Tick{ min } - Tick{ 1 }) == max);
+        static_assert(**(Tick{ min } / Tick{ -1 }) == min);
+        static_assert(**(Debt{ min } + Debt{ min }) == min + 1);
+        static_assert(**(Debt{ min } * Debt{ -1 }) == -1);
+
+        CHECK_THROWS_AS(Offset{ max } + Offset{ 1 }, std::out_of_range);
+        CHECK_THROWS_AS(Offset{ min } - Offset{ 1 }, std::out_of_range);
+        CHECK_THROWS_AS(Offset{ min } / Offset{ -1 }, std::out_of_range);
+        CHECK_THROWS_AS(-Offset{ min }, std::out_of_range);
+        CHECK(**(Offset{ min } % Offset{ -1 }) == 0);
+
+        Counter counter{ std::numeric_limits<uint64_t>::max() };
+        CHECK_THROWS_AS(++counter, std::out_of_range);
+        CHECK(**counter == std::numeric_limits<uint64_t>::max());
+        CHECK_THROWS_AS(Counter{ 0U } - Counter{ 1U }, std::out_of_range);
+    }
+
+    SECTION("Unchecked and debug-only policies")
+    {
+        static_assert(noexcept(Index{ 1 } + Index{ 1 }));
+        static_assert(**(Index{ 600 } + Index{ 500 }) == 1100);
+        static_assert(noexcept(Checked{ 1 } + Checked{ 1 }));
+        static_assert(**(Checked{ 2 } - Checked{ 5 }) == -3);
+    }
+
+    SECTION("Compile-time constants")
+    {
+        static_assert(*Percent::underlying_type::from_constant<42>() == 42);
+        static_assert(**Percent{ Percent::underlying_type::from_constant<42>() } == 42);
+        static_assert(percent_constant<100>);
+        static_assert(!percent_constant<101>);
+    }
+
+    SECTION("Comparisons")
+    {
+        static_assert(Percent{ 20 } < Percent{ 30 });
+        static_assert(Percent{ 130 } == Percent{ 100 });
+        static_assert(Degrees{ 370 } == Degrees{ 10 });
+        static_assert(Ratio{ -0.5 } <= Ratio{ -0.5 });
+    }
+
+    SECTION("Hashing, printing and containers of strong types")
+    {
+        CHECK(std::hash<Percent>{}(Percent{ 130 }) == std::hash<int>{}(100));
+        const std::unordered_set<Degrees> angles = { Degrees{ 10 }, Degrees{ 370 }, Degrees{ 20 } };
+        CHECK(angles.size() == 2);
+
+        std::ostringstream stream;
+        stream << Percent{ 42 };
+        CHECK(stream.str() == "42");
+        CHECK(std::format("{:>4}", Port{ 80 }) == "  80");
+    }
+}
+
+}  // namespace
+
+}  // namespace stronger::tests
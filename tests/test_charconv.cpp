@@ -0,0 +1,147 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <charconv>
+#include <cstdint>
+#include <expected>
+#include <string>
+#include <string_view>
+#include <stronger.hpp>
+#include <stronger/charconv.hpp>
+#include <system_error>
+#include <type_traits>
+
+namespace
+{
+
+/// Fixed-point decimal with two digits after the point, that <charconv> does not know
+struct Decimal
+{
+    uint64_t hundredths = 0;
+};
+
+}  // namespace
+
+template <>
+struct stronger::char_conversion<Decimal>
+{
+    static std::to_chars_result to_chars(char* first, char* const last, const Decimal value) noexcept
+    {
+        const auto [end, error] = std::to_chars(first, last, value.hundredths / 100);
+        if(error != std::errc{} || last - end < 3)
+            return { last, std::errc::value_too_large };
+        first = end;
+        *first++ = '.';
+        *first++ = static_cast<char>('0' + value.hundredths % 100 / 10);
+        *first++ = static_cast<char>('0' + value.hundredths % 10);
+        return { first, std::errc{} };
+    }
+
+    static std::from_chars_result from_chars(const char* const first, const char* const last, Decimal& value) noexcept
+    {
+        uint64_t units = 0;
+        uint64_t hundredths = 0;
+        const auto integer = std::from_chars(first, last, units);
+        if(integer.ec != std::errc{} || last - integer.ptr < 3 || *integer.ptr != '.')
+            return { first, std::errc::invalid_argument };
+        const auto fraction = std::from_chars(integer.ptr + 1, integer.ptr + 3, hundredths);
+        if(fraction.ec != std::errc{} || fraction.ptr != integer.ptr + 3)
+            return { first, std::errc::invalid_argument };
+        value.hundredths = units * 100 + hundredths;
+        return fraction;
+    }
+};
+
+namespace stronger::tests
+{
+
+namespace
+{
+
+using Price = strong_type<double, tag()>;
+using Volume = strong_type<int64_t, tag()>;
+using Flags = strong_type<uint8_t, tag()>;
+using Amount = strong_type<Decimal, tag()>;
+using Name = strong_type<std::string, tag()>;
+using Flag = strong_type<bool, tag()>;
+
+template <typename S, typename... Args>
+std::string to_string(const S& value, const Args... args)
+{
+    std::array<char, 64> buffer{};
+    const auto [end, error] = to_chars(buffer.data(), buffer.data() + buffer.size(), value, args...);
+    return error == std::errc{} ? std::string(buffer.data(), end) : std::string{};
+}
+
+template <typename S>
+concept is_parsable = requires(std::string_view text) { parse<S>(text); };
+
+TEST_CASE("Character conversions")
+{
+    SECTION("Types")
+    {
+        static_assert(concepts::to_chars_convertible<int64_t>);
+        static_assert(concepts::to_chars_convertible<int64_t, int>);
+        static_assert(concepts::to_chars_convertible<double, std::chars_format, int>);
+        static_assert(concepts::from_chars_convertible<Decimal>);
+        static_assert(!concepts::to_chars_convertible<std::string>);
+        static_assert(!concepts::to_chars_convertible<bool>);
+        static_assert(std::is_same_v<decltype(parse<Volume>("")), std::expected<Volume, std::errc>>);
+        static_assert(is_parsable<Amount>);
+        static_assert(!is_parsable<Name>);
+        static_assert(!is_parsable<Flag>);
+        static_assert(!is_parsable<int64_t>);
+    }
+
+    SECTION("to_chars")
+    {
+        CHECK(to_string(Volume{ -1234 }) == "-1234");
+        CHECK(to_string(Flags{ 255 }, 16) == "ff");
+        CHECK(to_string(Price{ 101.25 }) == "101.25");
+        CHECK(to_string(Price{ 101.25 }, std::chars_format::fixed, 3) == "101.250");
+        CHECK(to_string(Amount{ Decimal{ 1205 } }) == "12.05");
+
+        std::array<char, 2> small{};
+        const auto [end, error] = to_chars(small.data(), small.data() + small.size(), Volume{ 1234 });
+        CHECK(error == std::errc::value_too_large);
+        CHECK(end == small.data() + small.size());
+    }
+
+    SECTION("from_chars")
+    {
+        constexpr std::string_view text = "42,17.5";
+        Volume volume{ 1 };
+        const auto [end, error] = from_chars(text.data(), text.data() + text.size(), volume);
+        CHECK(error == std::errc{});
+        CHECK(*end == ',');
+        CHECK(*volume == 42);
+
+        Price price{};
+        CHECK(from_chars(end + 1, text.data() + text.size(), price).ec == std::errc{});
+        CHECK(*price == 17.5);
+
+        // The value is left unchanged on error
+        CHECK(from_chars(text.data() + 2, text.data() + text.size(), volume).ec == std::errc::invalid_argument);
+        CHECK(*volume == 42);
+    }
+
+    SECTION("parse")
+    {
+        CHECK(parse<Volume>("1234") == Volume{ 1234 });
+        CHECK(parse<Flags>("ff", 16) == Flags{ 255 });
+        CHECK(**parse<Price>("-0.5") == -0.5);
+        CHECK((*parse<Amount>("3.14"))->hundredths == 314);
+
+        CHECK(parse<Volume>("").error() == std::errc::invalid_argument);
+        CHECK(parse<Volume>("12a").error() == std::errc::invalid_argument);
+        CHECK(parse<Volume>(" 12").error() == std::errc::invalid_argument);
+        CHECK(parse<Flags>("256").error() == std::errc::result_out_of_range);
+        CHECK(parse<Amount>("3.1").error() == std::errc::invalid_argument);
+    }
+}
+
+}  // namespace
+
+}  // namespace stronger::tests
@@ -0,0 +1,35 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+// Only includes the core header, to check that it is self-sufficient
+#include <stronger/core.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+namespace stronger::tests
+{
+
+namespace
+{
+
+using Meters = strong_type<double, tag()>;
+using Seconds = strong_type<double, tag()>;
+
+static_assert(!std::is_same_v<Meters, Seconds>);
+static_assert(*(Meters{ 1.0 } + Meters{ 2.0 }) == 3.0);
+static_assert(Meters{ 1.0 } < Meters{ 2.0 });
+static_assert(*make_strong<Meters>(4.0) == 4.0);
+
+// Checked arithmetic is opt-in, but its types can be declared with the core header only
+using Cents = strong_type<int, tag(), options::checked_arithmetic>;
+static_assert(sizeof(Cents) == sizeof(int));
+
+TEST_CASE("Core header")
+{
+    Meters distance{ 1.0 };
+    distance += Meters{ 2.0 };
+    CHECK(distance == Meters{ 3.0 });
+}
+
+}  // namespace
+
+}  // namespace stronger::tests
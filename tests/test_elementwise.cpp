@@ -0,0 +1,103 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "helpers.h"
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <span>
+#include <stdexcept>
+#include <stronger.hpp>
+#include <stronger/elementwise.hpp>
+#include <vector>
+
+namespace stronger::tests
+{
+
+namespace
+{
+
+using Signal = strong_type<std::vector<double>, tag("elementwise::Signal"), options::elementwise>;
+using SignalView = strong_type<std::span<double>, tag("elementwise::Signal"), options::elementwise>;
+using ConstSignalView = strong_type<std::span<const double>, tag("elementwise::Signal"), options::elementwise>;
+using Noise = strong_type<std::vector<double>, tag("elementwise::Noise"), options::elementwise>;
+using Samples = strong_type<std::array<int, 3>, tag(), options::elementwise>;
+using Bytes = strong_type<std::vector<unsigned char>, tag(), options::elementwise>;
+using FloatSignal = strong_type<std::vector<float>, tag("elementwise::Signal"), options::elementwise>;
+using PlainSignal = strong_type<std::vector<double>, tag()>;
+
+TEST_CASE("Elementwise expressions")
+{
+    SECTION("Operands must have the same tag and value type")
+    {
+        static_assert(addable<Signal, Signal>);
+        static_assert(addable<Signal, SignalView>);
+        static_assert(addable<ConstSignalView, Signal>);
+        static_assert(!addable<Signal, Noise>);
+        static_assert(!addable<Signal, FloatSignal>);
+        static_assert(!addable<Signal, std::vector<double>>);
+        static_assert(!addable<PlainSignal, PlainSignal>);
+        static_assert(!addable<decltype(std::declval<Signal>() * std::declval<Signal>()), Noise>);
+    }
+
+    SECTION("Expressions are lazy")
+    {
+        const Signal a{ std::vector{ 1.0, 2.0, 3.0 } };
+        const Signal b{ std::vector{ 4.0, 5.0, 6.0 } };
+        const auto expression = a + b;
+        static_assert(traits::is_elementwise_expression<decltype(expression)>);
+        CHECK(expression.size() == 3);
+        CHECK(expression[1] == 7.0);
+    }
+
+    SECTION("Evaluation")
+    {
+        const Signal a{ std::vector{ 1.0, 2.0, 3.0 } };
+        const Signal b{ std::vector{ 4.0, 5.0, 6.0 } };
+        const Signal c{ std::vector{ 2.0, 2.0, 0.5 } };
+
+        const Signal result = a + b * c;
+        CHECK(*result == std::vector{ 9.0, 12.0, 6.0 });
+
+        Signal out;
+        out = -(a - b) / c;
+        CHECK(*out == std::vector{ 1.5, 1.5, 6.0 });
+
+        out = out + a;
+        CHECK(*out == std::vector{ 2.5, 3.5, 9.0 });
+    }
+
+    SECTION("Evaluation into views and fixed-size ranges")
+    {
+        const Signal a{ std::vector{ 1.0, 2.0, 3.0 } };
+        std::vector<double> storage(3);
+        const SignalView view{ std::span{ storage } };
+        (a * a).evaluate_into(view);
+        CHECK(storage == std::vector{ 1.0, 4.0, 9.0 });
+
+        const Samples samples{ std::array{ 1, 2, 3 } };
+        const Samples doubled = samples + samples;
+        CHECK(*doubled == std::array{ 2, 4, 6 });
+    }
+
+    SECTION("Integral promotions")
+    {
+        const Bytes bytes{ std::vector<unsigned char>{ 1, 2, 250 } };
+        const Bytes sum = bytes + bytes;
+        CHECK(*sum == std::vector<unsigned char>{ 2, 4, 244 });
+    }
+
+    SECTION("Sizes must match")
+    {
+        const Signal a{ std::vector{ 1.0, 2.0, 3.0 } };
+        const Signal b{ std::vector{ 1.0, 2.0 } };
+        CHECK_THROWS_AS(a + b, std::length_error);
+
+        std::vector<double> storage(2);
+        const SignalView view{ std::span{ storage } };
+        CHECK_THROWS_AS((a + a).evaluate_into(view), std::length_error);
+    }
+}
+
+}  // namespace
+
+}  // namespace stronger::tests
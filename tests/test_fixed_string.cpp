@@ -0,0 +1,109 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <format>
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <stronger.hpp>
+#include <stronger/fixed_string.hpp>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+namespace stronger::tests
+{
+
+namespace
+{
+
+using Currency = fixed_string_type<3, tag()>;
+using Ticker = fixed_string_type<8, tag()>;
+using Hostname = fixed_string_type<16, tag()>;
+
+TEST_CASE("Fixed strings")
+{
+    SECTION("Layout")
+    {
+        static_assert(sizeof(Currency) == 9);
+        static_assert(sizeof(Ticker) == 9);
+        static_assert(sizeof(Hostname) == 17);
+        static_assert(sizeof(fixed_string_type<300, tag()>) == 306);
+        static_assert(std::is_trivially_copyable_v<Hostname>);
+        static_assert(!std::is_same_v<Ticker, fixed_string_type<8, tag()>>);
+        static_assert(std::is_convertible_v<const char (&)[4], fixed_string<3>>);
+        static_assert(!std::is_convertible_v<const char (&)[5], fixed_string<3>>);
+        static_assert(!std::is_convertible_v<std::string_view, fixed_string<3>>);
+    }
+
+    SECTION("Construction and access")
+    {
+        constexpr Currency euro{ "EUR" };
+        static_assert(euro->size() == 3);
+        static_assert(euro->view() == "EUR");
+        static_assert((*euro)[1] == 'U');
+
+        const Ticker ticker{ fixed_string<8>(std::string_view("AAPL")) };
+        CHECK(ticker->view() == "AAPL");
+        CHECK(std::string(ticker.begin(), ticker.end()) == "AAPL");
+        CHECK(std::string_view(*ticker) == "AAPL");
+        CHECK(Ticker{}->empty());
+        CHECK_THROWS_AS(fixed_string<8>(std::string_view("TOO_LONG_")), std::length_error);
+
+        char buffer[16] = "AB";
+        const fixed_string<15> fromBuffer = buffer;
+        CHECK(fromBuffer.view() == "AB");
+        static_assert(fixed_string<3>("A\0C").size() == 1);
+
+        Ticker cleared = ticker;
+        cleared->clear();
+        CHECK(cleared == Ticker{});
+    }
+
+    SECTION("Comparison")
+    {
+        static_assert(Currency{ "EUR" } == Currency{ "EUR" });
+        static_assert(Currency{ "EUR" } != Currency{ "USD" });
+        static_assert(Currency{ "EU" } < Currency{ "EUR" });
+        static_assert(Currency{ "EUR" } < Currency{ "USD" });
+        static_assert(Hostname{ "host-10" } < Hostname{ "host-9" });
+        static_assert(Hostname{ "abcdefgh-2" } > Hostname{ "abcdefgh-10" });
+
+        // Same order as std::string, including characters above 127 and null characters
+        const std::vector<std::string> texts = { "b", "a\xff", "a", "", "a\x7f", std::string("a\0", 2), "ab" };
+        std::vector<Hostname> hostnames;
+        for(const std::string& text : texts)
+            hostnames.emplace_back(fixed_string<16>(text));
+        std::vector<std::string> sortedTexts = texts;
+        std::ranges::sort(sortedTexts);
+        std::ranges::sort(hostnames);
+        for(std::size_t i = 0; i < texts.size(); ++i)
+            CHECK(hostnames[i]->view() == sortedTexts[i]);
+    }
+
+    SECTION("Hashing and printing")
+    {
+        static_assert(Currency{ "EUR" }->hash() == fixed_string<3>("EUR").hash());
+        CHECK(std::hash<Ticker>{}(Ticker{ "AAPL" }) == std::hash<Ticker>{}(Ticker{ fixed_string<8>(std::string("AAPL")) }));
+        CHECK(std::hash<Ticker>{}(Ticker{ "AAPL" }) != std::hash<Ticker>{}(Ticker{ "MSFT" }));
+
+        const std::unordered_set<Ticker> tickers = { Ticker{ "AAPL" }, Ticker{ "MSFT" }, Ticker{ "AAPL" } };
+        CHECK(tickers.size() == 2);
+        CHECK(tickers.contains(Ticker{ "MSFT" }));
+
+        std::ostringstream stream;
+        stream << Currency{ "EUR" };
+        CHECK(stream.str() == "EUR");
+        CHECK(std::format("{}", Currency{ "EUR" }) == "EUR");
+        CHECK(std::format("{:>5}", fixed_string<8>("AAPL")) == " AAPL");
+    }
+}
+
+}  // namespace
+
+}  // namespace stronger::tests
@@ -0,0 +1,149 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <stronger.hpp>
+#include <stronger/containers/flat_map.hpp>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace stronger::tests
+{
+
+namespace
+{
+
+using RouteId = strong_type<uint32_t, tag()>;
+using Latency = strong_type<double, tag()>;
+using Hostname = strong_type<std::string, tag()>;
+using Flag = strong_type<bool, tag()>;
+
+TEST_CASE("Flat maps")
+{
+    SECTION("Types")
+    {
+        static_assert(std::is_same_v<flat_map<RouteId, int>::reference, std::pair<RouteId, int&>>);
+        static_assert(std::is_same_v<flat_map<RouteId, int>::const_reference, std::pair<RouteId, const int&>>);
+        static_assert(std::is_same_v<flat_map<Hostname, int>::reference, std::pair<const Hostname&, int&>>);
+        static_assert(std::is_same_v<flat_set<RouteId>::reference, RouteId>);
+        static_assert(std::is_convertible_v<flat_map<RouteId, int>::iterator, flat_map<RouteId, int>::const_iterator>);
+        static_assert(!std::is_convertible_v<flat_map<RouteId, int>::const_iterator, flat_map<RouteId, int>::iterator>);
+        static_assert(!concepts::flat_key<uint32_t>);
+        static_assert(concepts::flat_key<Hostname>);
+    }
+
+    SECTION("Bulk construction")
+    {
+        const flat_map<RouteId, std::string> routes({ { RouteId{ 30 }, "c" },
+                                                      { RouteId{ 10 }, "a" },
+                                                      { RouteId{ 20 }, "b" },
+                                                      { RouteId{ 10 }, "duplicate" } });
+        CHECK(routes.size() == 3);
+        CHECK(routes.at(RouteId{ 10 }) == "a");
+        CHECK_THROWS_AS(routes.at(RouteId{ 15 }), std::out_of_range);
+
+        std::vector<RouteId> ids;
+        for(const auto [id, name] : routes)
+        {
+            ids.push_back(id);
+            CHECK(!name.empty());
+        }
+        CHECK(ids == std::vector{ RouteId{ 10 }, RouteId{ 20 }, RouteId{ 30 } });
+        CHECK(routes.begin()->second == "a");
+        CHECK((routes.end() - 1)->first == RouteId{ 30 });
+    }
+
+    SECTION("Lookups")
+    {
+        std::vector<std::pair<RouteId, int>> elements;
+        for(uint32_t i = 0; i < 1000; ++i)
+            elements.emplace_back(RouteId{ (i * 7919) % 1000 * 2 }, static_cast<int>(i));
+        const flat_map<RouteId, int> routes(elements);
+
+        for(uint32_t id = 0; id < 2000; ++id)
+        {
+            CHECK(routes.contains(RouteId{ id }) == (id % 2 == 0));
+            const auto lower = routes.lower_bound(RouteId{ id });
+            CHECK(lower - routes.begin() == (id + 1) / 2);
+        }
+        CHECK(routes.find(RouteId{ 1 }) == routes.end());
+        CHECK(routes.find(RouteId{ 2000 }) == routes.end());
+        CHECK(routes.count(RouteId{ 0 }) == 1);
+        CHECK(flat_map<RouteId, int>{}.find(RouteId{ 0 }) == flat_map<RouteId, int>{}.end());
+    }
+
+    SECTION("Modifiers")
+    {
+        flat_map<RouteId, std::string> routes;
+        CHECK(routes.try_emplace(RouteId{ 2 }, "b").second);
+        CHECK(!routes.try_emplace(RouteId{ 2 }, "ignored").second);
+        CHECK(routes.insert({ RouteId{ 1 }, "a" }).second);
+        CHECK(!routes.insert_or_assign(RouteId{ 1 }, "A").second);
+        routes[RouteId{ 3 }] = "c";
+        CHECK(routes == flat_map<RouteId, std::string>{ { RouteId{ 1 }, "A" },
+                                                        { RouteId{ 2 }, "b" },
+                                                        { RouteId{ 3 }, "c" } });
+
+        for(auto [id, name] : routes)
+            name += "!";
+        CHECK(routes.at(RouteId{ 2 }) == "b!");
+
+        CHECK(routes.erase(RouteId{ 2 }) == 1);
+        CHECK(routes.erase(RouteId{ 2 }) == 0);
+        CHECK(routes.erase(routes.begin())->first == RouteId{ 3 });
+        CHECK(routes.size() == 1);
+        routes.clear();
+        CHECK(routes.empty());
+    }
+
+    SECTION("Keys of other underlying types")
+    {
+        flat_map<Hostname, int> hosts({ { Hostname{ "db" }, 2 }, { Hostname{ "api" }, 1 } });
+        hosts[Hostname{ "cache" }] = 3;
+        CHECK(hosts.begin()->first == Hostname{ "api" });
+        CHECK(hosts.at(Hostname{ "cache" }) == 3);
+        CHECK(!hosts.contains(Hostname{ "web" }));
+
+        const flat_map<Latency, int> latencies({ { Latency{ 2.5 }, 1 }, { Latency{ -1.0 }, 0 } });
+        CHECK(latencies.begin()->first == Latency{ -1.0 });
+        CHECK(latencies.contains(Latency{ 2.5 }));
+
+        // Stored as strong types: unwrapped, they would make a std::vector<bool>
+        flat_map<Flag, int> flags({ { Flag{ true }, 1 }, { Flag{ false }, 0 } });
+        CHECK(flags.begin()->first == Flag{ false });
+        CHECK(flags.at(Flag{ true }) == 1);
+        flags.erase(Flag{ false });
+        CHECK(flags.size() == 1);
+        CHECK(flat_set<Flag>{ Flag{ true }, Flag{ true } }.size() == 1);
+    }
+}
+
+TEST_CASE("Flat sets")
+{
+    flat_set<RouteId> ids({ RouteId{ 3 }, RouteId{ 1 }, RouteId{ 2 }, RouteId{ 3 } });
+    CHECK(ids.size() == 3);
+    CHECK(std::ranges::equal(ids, std::vector{ RouteId{ 1 }, RouteId{ 2 }, RouteId{ 3 } }));
+    CHECK(*ids.find(RouteId{ 2 }) == RouteId{ 2 });
+    CHECK(ids.find(RouteId{ 4 }) == ids.end());
+
+    CHECK(ids.insert(RouteId{ 0 }).second);
+    CHECK(!ids.insert(RouteId{ 0 }).second);
+    CHECK(*ids.begin() == RouteId{ 0 });
+    CHECK(ids.erase(RouteId{ 1 }) == 1);
+    CHECK(*ids.erase(ids.begin()) == RouteId{ 2 });
+    CHECK(ids == flat_set<RouteId>{ RouteId{ 2 }, RouteId{ 3 } });
+
+    const flat_set<Hostname> hosts = { Hostname{ "db" }, Hostname{ "api" } };
+    CHECK(hosts.contains(Hostname{ "api" }));
+    CHECK(**hosts.begin() == "api");
+}
+
+}  // namespace
+
+}  // namespace stronger::tests
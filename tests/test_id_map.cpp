@@ -0,0 +1,185 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <stronger.hpp>
+#include <stronger/containers/id_map.hpp>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+namespace stronger::tests
+{
+
+namespace
+{
+
+using EntityId = strong_type<uint32_t, tag()>;
+using Offset = strong_type<int64_t, tag()>;
+
+/// Its copy constructor throws once `copies` copies have been made. Moves never throw
+struct throwing_copy
+{
+    static inline int copies = 0;
+    static inline int instances = 0;
+
+    int value = 0;
+
+    explicit throwing_copy(const int v) noexcept : value(v) { ++instances; }
+
+    throwing_copy(const throwing_copy& other) : value(other.value)
+    {
+        if(copies-- == 0)
+            throw std::runtime_error("copy");
+        ++instances;
+    }
+
+    throwing_copy(throwing_copy&& other) noexcept : value(other.value) { ++instances; }
+
+    throwing_copy& operator=(const throwing_copy&) = default;
+    throwing_copy& operator=(throwing_copy&&) noexcept = default;
+    ~throwing_copy() { --instances; }
+};
+
+TEST_CASE("Id maps")
+{
+    SECTION("Types")
+    {
+        static_assert(std::is_same_v<id_map<EntityId, int>::reference, std::pair<EntityId, int&>>);
+        static_assert(std::is_convertible_v<id_map<EntityId, int>::iterator, id_map<EntityId, int>::const_iterator>);
+        static_assert(!concepts::id_key<uint32_t>);
+        static_assert(!concepts::id_key<strong_type<std::string, tag()>>);
+        static_assert(!concepts::id_key<strong_type<bool, tag()>>);
+        static_assert(concepts::id_key<Offset>);
+    }
+
+    SECTION("Insertion and lookup")
+    {
+        id_map<EntityId, std::string> names;
+        CHECK(names.empty());
+        CHECK(names.find(EntityId{ 1 }) == names.end());
+        CHECK(names.begin() == names.end());
+
+        for(uint32_t i = 0; i < 10'000; ++i)
+            CHECK(names.try_emplace(EntityId{ i }, std::to_string(i)).second);
+        CHECK(names.size() == 10'000);
+        CHECK(names.capacity() >= 10'000);
+        CHECK(!names.try_emplace(EntityId{ 42 }, "ignored").second);
+        CHECK(names.at(EntityId{ 42 }) == "42");
+        CHECK(names.find(EntityId{ 9999 })->second == "9999");
+        CHECK(!names.contains(EntityId{ 10'000 }));
+        CHECK_THROWS_AS(names.at(EntityId{ 10'000 }), std::out_of_range);
+
+        CHECK(!names.insert_or_assign(EntityId{ 7 }, "seven").second);
+        CHECK(names.insert({ EntityId{ 10'000 }, "last" }).second);
+        names[EntityId{ 10'001 }] += "new";
+        CHECK(names.at(EntityId{ 7 }) == "seven");
+        CHECK(names.at(EntityId{ 10'001 }) == "new");
+
+        // The argument refers to a value that growing moves
+        id_map<EntityId, std::string> copies;
+        copies.try_emplace(EntityId{ 0 }, "copied");
+        for(uint32_t i = 1; i < 100; ++i)
+            copies.try_emplace(EntityId{ i }, copies.at(EntityId{ 0 }));
+        CHECK(copies.at(EntityId{ 99 }) == "copied");
+    }
+
+    SECTION("Iteration and erasure")
+    {
+        id_map<Offset, int> offsets;
+        for(int64_t i = -500; i < 500; ++i)
+            offsets[Offset{ i }] = static_cast<int>(i);
+
+        int64_t sum = 0;
+        for(const auto [offset, value] : offsets)
+        {
+            CHECK(*offset == value);
+            sum += *offset;
+        }
+        CHECK(sum == -500);
+
+        for(auto [offset, value] : offsets)
+            value *= 2;
+        CHECK(offsets.at(Offset{ -3 }) == -6);
+
+        CHECK(offsets.erase(Offset{ 0 }) == 1);
+        CHECK(offsets.erase(Offset{ 0 }) == 0);
+        for(auto it = offsets.begin(); it != offsets.end();)
+            it = it->second % 4 == 0 ? offsets.erase(it) : std::next(it);
+        CHECK(offsets.size() == 500);
+        CHECK(!offsets.contains(Offset{ 2 }));
+        CHECK(offsets.contains(Offset{ 1 }));
+
+        const id_map<Offset, int> copy = offsets;
+        CHECK(copy == offsets);
+        offsets.clear();
+        CHECK(offsets.empty());
+        CHECK(copy != offsets);
+        CHECK(copy.size() == 500);
+    }
+
+    SECTION("Keys 128 apart")
+    {
+        // Their hashes only differ above their 7 low bits
+        id_map<EntityId, uint32_t> aligned;
+        for(uint32_t i = 0; i < 10'000; ++i)
+            aligned.try_emplace(EntityId{ i * 128 }, i);
+        for(uint32_t i = 0; i < 10'000; i += 2)
+            aligned.erase(EntityId{ i * 128 });
+        CHECK(aligned.size() == 5'000);
+        for(uint32_t i = 0; i < 10'000; ++i)
+        {
+            CHECK(aligned.contains(EntityId{ i * 128 }) == (i % 2 == 1));
+            CHECK(!aligned.contains(EntityId{ i * 128 + 1 }));
+        }
+    }
+
+    SECTION("Copies release what they built when a copy throws")
+    {
+        id_map<EntityId, throwing_copy> values;
+        for(uint32_t i = 0; i < 100; ++i)
+            values.try_emplace(EntityId{ i }, static_cast<int>(i));
+        const int instances = throwing_copy::instances;
+
+        throwing_copy::copies = 50;
+        CHECK_THROWS_AS((id_map<EntityId, throwing_copy>{ values }), std::runtime_error);
+        CHECK(throwing_copy::instances == instances);
+
+        throwing_copy::copies = 100;
+        const id_map<EntityId, throwing_copy> copy = values;
+        CHECK(copy.size() == 100);
+        CHECK(throwing_copy::instances == 2 * instances);
+    }
+
+    SECTION("Same contents as std::unordered_map")
+    {
+        std::mt19937 generator(42);
+        id_map<EntityId, std::unique_ptr<uint32_t>> map;
+        std::unordered_map<uint32_t, uint32_t> reference;
+        for(int i = 0; i < 200'000; ++i)
+        {
+            const auto id = static_cast<uint32_t>(generator() % 5000);
+            if(generator() % 3 == 0)
+            {
+                CHECK(map.erase(EntityId{ id }) == reference.erase(id));
+            }
+            else
+            {
+                map.insert_or_assign(EntityId{ id }, std::make_unique<uint32_t>(id + 1));
+                reference[id] = id + 1;
+            }
+        }
+        CHECK(map.size() == reference.size());
+        for(const auto& [id, value] : map)
+            CHECK(reference.at(*id) == *value);
+    }
+}
+
+}  // namespace
+
+}  // namespace stronger::tests
@@ -0,0 +1,121 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <set>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <stronger.hpp>
+#include <stronger/interned.hpp>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace stronger::tests
+{
+
+namespace
+{
+
+using Symbol = interned<tag()>;
+using Host = interned<tag()>;
+
+TEST_CASE("Interned strings")
+{
+    SECTION("Types")
+    {
+        static_assert(sizeof(Symbol) == 4);
+        static_assert(std::is_trivially_copyable_v<Symbol>);
+        static_assert(!std::is_same_v<Symbol, Host>);
+        static_assert(!std::is_convertible_v<std::string_view, Symbol>);
+        static_assert(!std::equality_comparable_with<Symbol, Host>);
+        static_assert(std::is_same_v<decltype(*Symbol{}), std::string_view>);
+        static_assert(traits::is_interned<const Symbol&>);
+        static_assert(!traits::is_interned<strong_type<std::string, tag()>>);
+    }
+
+    SECTION("Unique storage")
+    {
+        const Symbol first("AAPL");
+        const std::string text = "AAPL";
+        const Symbol second(text);
+        const Symbol other("MSFT");
+
+        CHECK(first == second);
+        CHECK(first.handle() == second.handle());
+        CHECK((*first).data() == (*second).data());
+        CHECK(first != other);
+        CHECK(*other == "MSFT");
+        CHECK(other->size() == 4);
+        CHECK(first < other);
+        CHECK(Symbol{} == Symbol(""));
+        CHECK(Symbol{}->empty());
+
+        // Each tag has its own pool
+        const std::size_t symbols = Symbol::pool_size();
+        static_cast<void>(Host("AAPL"));
+        CHECK(Symbol::pool_size() == symbols);
+    }
+
+    SECTION("Large pools")
+    {
+        std::vector<Symbol> symbols;
+        for(int i = 0; i < 5000; ++i)
+            symbols.emplace_back("symbol-" + std::to_string(i));
+        symbols.emplace_back(std::string(100'000, 'x'));
+
+        CHECK(*symbols[4321] == "symbol-4321");
+        CHECK(symbols.back()->size() == 100'000);
+        CHECK(Symbol("symbol-42") == symbols[42]);
+    }
+
+    SECTION("Hashing and printing")
+    {
+        std::unordered_map<Symbol, int> volumes;
+        volumes[Symbol("AAPL")] += 10;
+        volumes[Symbol("AAPL")] += 5;
+        CHECK(volumes.size() == 1);
+        CHECK(volumes[Symbol("AAPL")] == 15);
+        CHECK(std::hash<Symbol>{}(Symbol("AAPL")) == std::hash<Symbol>{}(Symbol(std::string("AAPL"))));
+
+        std::ostringstream stream;
+        stream << Symbol("AAPL");
+        CHECK(stream.str() == "AAPL");
+        CHECK(std::format("{:<6}|", Symbol("AAPL")) == "AAPL  |");
+    }
+
+    SECTION("Concurrent interning")
+    {
+        constexpr int Threads = 8;
+        constexpr int Strings = 2000;
+        std::vector<std::vector<Symbol>> results(Threads);
+        std::vector<std::thread> threads;
+        for(int t = 0; t < Threads; ++t)
+            threads.emplace_back(
+                [&results, t]
+                {
+                    for(int i = 0; i < Strings; ++i)
+                        results[static_cast<std::size_t>(t)].emplace_back("concurrent-" + std::to_string(i));
+                });
+        for(std::thread& thread : threads)
+            thread.join();
+
+        std::set<uint32_t> handles;
+        for(const Symbol symbol : results[0])
+            handles.insert(symbol.handle());
+        CHECK(handles.size() == Strings);
+        for(const std::vector<Symbol>& result : results)
+            CHECK(result == results[0]);
+        CHECK(*results[3][1234] == "concurrent-1234");
+    }
+}
+
+}  // namespace
+
+}  // namespace stronger::tests
@@ -27,6 +27,27 @@ public:
 
 using StrongTest = strong_type<Test, tag()>;
 
+struct copy_move_count
+{
+    int copies = 0;
+    int moves = 0;
+};
+
+class Counted
+{
+public:
+
+    constexpr explicit(false) Counted(copy_move_count* count) : m_count(count) {}
+    constexpr Counted(const Counted& other) : m_count(other.m_count) { ++m_count->copies; }
+    constexpr Counted(Counted&& other) noexcept : m_count(other.m_count) { ++m_count->moves; }
+    Counted& operator=(const Counted&) = delete;
+    Counted& operator=(Counted&&) noexcept = delete;
+    copy_move_count* m_count;
+};
+
+using StrongCounted = strong_type<Counted, tag()>;
+using ImplicitStrongCounted = strong_type<Counted, tag(), options::allow_implicit_construction>;
+
 template <typename Callable>
 using Function = strong_type<Callable, tag()>;
 
@@ -65,6 +86,59 @@ TEST_CASE("make_strong, make_templated_strong")
     }
 }
 
+TEST_CASE("Construction copies and moves")
+{
+    SECTION("From an lvalue of the underlying type -> a single copy")
+    {
+        static_assert([]
+        {
+            copy_move_count count;
+            const Counted value(&count);
+            const StrongCounted strong{ value };
+            return count.copies == 1 && count.moves == 0 && strong->m_count == &count;
+        }());
+    }
+
+    SECTION("From an rvalue of the underlying type -> a single move")
+    {
+        static_assert([]
+        {
+            copy_move_count count;
+            Counted value(&count);
+            const StrongCounted strong{ std::move(value) };
+            return count.copies == 0 && count.moves == 1 && strong->m_count == &count;
+        }());
+    }
+
+    SECTION("From arguments of the underlying type constructor -> constructed in place")
+    {
+        static_assert([]
+        {
+            copy_move_count count;
+            const StrongCounted strong{ &count };
+            return count.copies == 0 && count.moves == 0 && strong->m_count == &count;
+        }());
+    }
+
+    SECTION("Implicit construction from lvalues and convertible types")
+    {
+        static_assert(std::is_convertible_v<const Counted&, ImplicitStrongCounted>);
+        static_assert(std::is_convertible_v<copy_move_count*, ImplicitStrongCounted>);
+        static_assert(!std::is_convertible_v<const Counted&, StrongCounted>);
+        static_assert(!std::is_convertible_v<copy_move_count*, StrongCounted>);
+        static_assert(!std::is_constructible_v<StrongCounted, ImplicitStrongCounted>);
+
+        static_assert([]
+        {
+            copy_move_count count;
+            const Counted value(&count);
+            const ImplicitStrongCounted fromLvalue = value;
+            const ImplicitStrongCounted converted = &count;
+            return count.copies == 1 && count.moves == 0 && fromLvalue->m_count == converted->m_count;
+        }());
+    }
+}
+
 }  // namespace
 
 }  // namespace stronger::tests
\ No newline at end of file
@@ -0,0 +1,129 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include <algorithm>
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <stronger.hpp>
+#include <stronger/mapped_column.hpp>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace stronger::tests
+{
+
+namespace
+{
+
+using UserId = strong_type<int64_t, tag("UserId")>;
+using OrderId = strong_type<int64_t, tag("OrderId")>;
+using Price = strong_type<double, tag("Price")>;
+using Ratio = strong_type<float, tag("Price")>;
+using Name = strong_type<std::string, tag()>;
+using Flag = strong_type<bool, tag()>;
+
+/// Removes the file when going out of scope
+struct temporary_file
+{
+    explicit temporary_file(const std::string& name) :
+            path(std::filesystem::temp_directory_path() / ("stronger_" + name))
+    {
+    }
+
+    ~temporary_file() { std::filesystem::remove(path); }
+
+    std::filesystem::path path;
+};
+
+TEST_CASE("Mapped columns")
+{
+    SECTION("Types")
+    {
+        static_assert(concepts::mappable_strong_type<UserId>);
+        static_assert(concepts::mappable_strong_type<Price>);
+        static_assert(concepts::mappable_strong_type<strong_type<uint8_t, tag()>>);
+        static_assert(!concepts::mappable_strong_type<Name>);
+        static_assert(!concepts::mappable_strong_type<Flag>);
+        static_assert(!concepts::mappable_strong_type<int64_t>);
+        static_assert(!std::is_copy_constructible_v<mapped_column<UserId>>);
+        static_assert(std::is_nothrow_move_constructible_v<mapped_column<UserId>>);
+    }
+
+    SECTION("Round trip")
+    {
+        const temporary_file file("users.col");
+        std::vector<UserId> users(1000);
+        for(size_t i = 0; i < users.size(); ++i)
+            users[i] = UserId{ static_cast<int64_t>(i * 3) };
+        mapped_column<UserId>::write(file.path, users);
+        CHECK(std::filesystem::file_size(file.path) == 32 + users.size() * sizeof(UserId));
+
+        mapped_column<UserId> column(file.path);
+        REQUIRE(column.size() == users.size());
+        CHECK(*column[999] == 2997);
+        CHECK(std::equal(column.begin(), column.end(), users.begin()));
+        const std::span<const UserId> values = column.values();
+        CHECK(std::accumulate(values.begin(), values.end(), int64_t{ 0 },
+                              [](const int64_t sum, const UserId id) { return sum + *id; }) == 1498500);
+
+        // The mapping is owned by the column, and moves with it
+        const mapped_column<UserId> moved = std::move(column);
+        CHECK(*moved[1] == 3);
+    }
+
+    SECTION("Floating point and empty columns")
+    {
+        const temporary_file file("prices.col");
+        const std::array prices = { Price{ 10.5 }, Price{ -0.25 } };
+        mapped_column<Price>::write(file.path, prices);
+        const mapped_column<Price> column(file.path);
+        CHECK(*column[1] == -0.25);
+
+        mapped_column<Price>::write(file.path, {});
+        CHECK(mapped_column<Price>(file.path).empty());
+    }
+
+    SECTION("Columns of other types are rejected")
+    {
+        const temporary_file file("ids.col");
+        const std::array users = { UserId{ 1 }, UserId{ 2 } };
+        mapped_column<UserId>::write(file.path, users);
+
+        // Same underlying type, different tag
+        CHECK_THROWS_AS(mapped_column<OrderId>(file.path), std::runtime_error);
+        // Same tag, different underlying type
+        const temporary_file prices("float.col");
+        mapped_column<Ratio>::write(prices.path, std::array{ Ratio{ 0.5F }, Ratio{ 1.5F } });
+        CHECK_THROWS_AS(mapped_column<Price>(prices.path), std::runtime_error);
+    }
+
+    SECTION("Invalid files are rejected")
+    {
+        CHECK_THROWS_AS(mapped_column<UserId>(std::filesystem::temp_directory_path() / "stronger_missing.col"),
+                        std::system_error);
+
+        const temporary_file file("invalid.col");
+        std::ofstream(file.path) << "id\n1\n2\n";
+        CHECK_THROWS_AS(mapped_column<UserId>(file.path), std::runtime_error);
+
+        // The header announces more values than the file holds
+        const std::array users = { UserId{ 1 }, UserId{ 2 } };
+        mapped_column<UserId>::write(file.path, users);
+        std::filesystem::resize_file(file.path, 32 + sizeof(UserId));
+        CHECK_THROWS_AS(mapped_column<UserId>(file.path), std::runtime_error);
+    }
+}
+
+}  // namespace
+
+}  // namespace stronger::tests
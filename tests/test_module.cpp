@@ -0,0 +1,50 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+// Built only with STRONGER_CPP_BUILD_MODULE: the specializations of std::hash, std::formatter and std::atomic are
+// declared in the global module fragment of stronger.cppm, and importing the module must still find them.
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <unordered_set>
+import stronger;
+
+namespace stronger::tests
+{
+
+namespace
+{
+
+using Counter = strong_type<uint64_t, tag()>;
+using Currency = fixed_string_type<3, tag()>;
+
+TEST_CASE("Named module")
+{
+    SECTION("std::hash")
+    {
+        CHECK(std::hash<Counter>{}(Counter{ 42 }) == std::hash<uint64_t>{}(42));
+        const std::unordered_set<Counter> counters = { Counter{ 1 }, Counter{ 2 }, Counter{ 1 } };
+        CHECK(counters.size() == 2);
+    }
+
+    SECTION("std::format")
+    {
+        CHECK(std::format("{}", Counter{ 42 }) == "42");
+        CHECK(std::format("{:>4}", Currency{ "EUR" }) == " EUR");
+    }
+
+    SECTION("std::atomic")
+    {
+        std::atomic<Counter> counter{ Counter{ 1 } };
+        counter.fetch_add(Counter{ 2 });
+        ++counter;
+        CHECK(counter.load() == Counter{ 4 });
+    }
+}
+
+}  // namespace
+
+}  // namespace stronger::tests
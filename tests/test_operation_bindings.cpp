@@ -8,6 +8,7 @@
 #include <catch2/catch_test_macros.hpp>
 #include <filesystem>
 #include <string>
+#include <string_view>
 #include <format>
 
 namespace stronger::tests
@@ -271,6 +272,82 @@ constexpr void test_hash(const Strong& lhs, auto* instructions)
         throw assertion_error("std::hash<Strong>{}(lhs) returned wrong value");
 }
 
+template <bool NoExcept>
+consteval bool test_noexcept_is_mirrored()
+{
+    using Underlying = basic_mock_type<NoExcept>;
+    using StrongMock = strong_type<Underlying, tag()>;
+    [[maybe_unused]] StrongMock lhs;
+    [[maybe_unused]] StrongMock rhs;
+
+    // Construction and accessors
+    static_assert(std::is_nothrow_constructible_v<StrongMock, Underlying&&> ==
+                  std::is_nothrow_constructible_v<Underlying, Underlying&&>);
+    static_assert(std::is_nothrow_constructible_v<StrongMock, std::in_place_t, int, std::vector<instruction>*> ==
+                  NoExcept);
+    static_assert(noexcept(*lhs));
+    static_assert(noexcept(*std::move(lhs)));
+    static_assert(noexcept(lhs.operator->()));
+
+    // Arithmetic operators
+    static_assert(noexcept(+rhs) == NoExcept);
+    static_assert(noexcept(-rhs) == NoExcept);
+    static_assert(noexcept(lhs + rhs) == NoExcept);
+    static_assert(noexcept(std::move(lhs) + rhs) == NoExcept);
+    static_assert(noexcept(lhs - rhs) == NoExcept);
+    static_assert(noexcept(lhs - std::move(rhs)) == NoExcept);
+    static_assert(noexcept(lhs * rhs) == NoExcept);
+    static_assert(noexcept(lhs / rhs) == NoExcept);
+    static_assert(noexcept(lhs % rhs) == NoExcept);
+    static_assert(noexcept(~rhs) == NoExcept);
+    static_assert(noexcept(lhs & rhs) == NoExcept);
+    static_assert(noexcept(lhs | rhs) == NoExcept);
+    static_assert(noexcept(lhs ^ rhs) == NoExcept);
+    static_assert(noexcept(lhs << rhs) == NoExcept);
+    static_assert(noexcept(lhs >> rhs) == NoExcept);
+
+    // Assignment operators
+    static_assert(noexcept(lhs += rhs) == NoExcept);
+    static_assert(noexcept(lhs -= rhs) == NoExcept);
+    static_assert(noexcept(lhs *= rhs) == NoExcept);
+    static_assert(noexcept(lhs /= rhs) == NoExcept);
+    static_assert(noexcept(lhs %= rhs) == NoExcept);
+    static_assert(noexcept(lhs &= rhs) == NoExcept);
+    static_assert(noexcept(lhs |= rhs) == NoExcept);
+    static_assert(noexcept(lhs ^= rhs) == NoExcept);
+    static_assert(noexcept(lhs <<= rhs) == NoExcept);
+    static_assert(noexcept(lhs >>= rhs) == NoExcept);
+
+    // Increment and decrement operators
+    static_assert(noexcept(++lhs) == NoExcept);
+    static_assert(noexcept(--lhs) == NoExcept);
+    static_assert(noexcept(lhs++) == NoExcept);
+    static_assert(noexcept(lhs--) == NoExcept);
+
+    // Comparison and logical operators
+    static_assert(noexcept(lhs == rhs) == NoExcept);
+    static_assert(noexcept(lhs != rhs) == NoExcept);
+    static_assert(noexcept(lhs < rhs) == NoExcept);
+    static_assert(noexcept(lhs > rhs) == NoExcept);
+    static_assert(noexcept(lhs <= rhs) == NoExcept);
+    static_assert(noexcept(lhs >= rhs) == NoExcept);
+    static_assert(noexcept(lhs <=> rhs) == NoExcept);
+    static_assert(noexcept(!rhs) == NoExcept);
+
+    // Other operators
+    static_assert(noexcept(StrongMock::operator()(*lhs, 10)) == NoExcept);
+    static_assert(noexcept(lhs(10)) == NoExcept);
+    static_assert(noexcept(StrongMock::operator[](*lhs, 10)) == NoExcept);
+    static_assert(noexcept(lhs[10]) == NoExcept);
+    static_assert(noexcept(std::declval<std::ostream&>() << lhs) == NoExcept);
+    static_assert(noexcept(lhs.begin()) == NoExcept);
+    static_assert(noexcept(lhs.end()) == NoExcept);
+    return true;
+}
+
+static_assert(test_noexcept_is_mirrored<true>());
+static_assert(test_noexcept_is_mirrored<false>());
+
 constexpr bool test_operation_bindings()
 {
     std::vector<instruction> instructions;
@@ -321,4 +398,148 @@ TEST_CASE("Operation bindings")
 
 }  // namespace
 
-}  // namespace stronger::tests
\ No newline at end of file
+}  // namespace stronger::tests
+
+// Bindings between different strong types _____________________________________________________________________________
+
+namespace stronger::tests::bindings
+{
+
+using Price = strong_type<double, tag()>;
+using Quantity = strong_type<double, tag()>;
+using Notional = strong_type<double, tag()>;
+using Limit = strong_type<double, tag()>;
+using Timestamp = strong_type<int64_t, tag()>;
+using Duration = strong_type<int64_t, tag()>;
+using Text = strong_type<std::string, tag()>;
+
+}  // namespace stronger::tests::bindings
+
+template <>
+struct stronger::binding<stronger::operations::multiplication, stronger::tests::bindings::Price,
+                         stronger::tests::bindings::Quantity>
+{
+    using result = tests::bindings::Notional;
+};
+
+template <>
+struct stronger::binding<stronger::operations::subtraction, stronger::tests::bindings::Timestamp,
+                         stronger::tests::bindings::Timestamp>
+{
+    using result = tests::bindings::Duration;
+};
+
+template <>
+struct stronger::binding<stronger::operations::addition, stronger::tests::bindings::Timestamp,
+                         stronger::tests::bindings::Duration>
+{
+    using result = tests::bindings::Timestamp;
+};
+
+template <>
+struct stronger::binding<stronger::operations::multiplication, stronger::tests::bindings::Duration, int64_t>
+{
+    using result = tests::bindings::Duration;
+};
+
+template <>
+struct stronger::binding<stronger::operations::three_way_comparison, stronger::tests::bindings::Price,
+                         stronger::tests::bindings::Limit>
+{
+    using result = std::partial_ordering;
+};
+
+template <>
+struct stronger::binding<stronger::operations::equal_to, stronger::tests::bindings::Text, std::string_view>
+{
+    using result = bool;
+};
+
+template <>
+struct stronger::binding<stronger::operations::equal_to, stronger::tests::bindings::Duration, int64_t>
+{
+    using result = int64_t;
+};
+
+template <>
+struct stronger::binding<stronger::operations::less_than, stronger::tests::bindings::Duration, int64_t>
+{
+    using result = int;
+};
+
+template <>
+struct stronger::binding<stronger::operations::less_than, stronger::tests::bindings::Quantity,
+                         stronger::tests::bindings::Notional>
+{
+    using result = tests::bindings::Notional;
+};
+
+namespace stronger::tests::bindings
+{
+
+namespace
+{
+
+TEST_CASE("Bindings between different types")
+{
+    SECTION("Bound operations result in the declared type")
+    {
+        static_assert(std::is_same_v<decltype(Price{} * Quantity{}), Notional>);
+        static_assert(std::is_same_v<decltype(Timestamp{} + Duration{}), Timestamp>);
+        static_assert(std::is_same_v<decltype(Duration{} * int64_t{}), Duration>);
+        static_assert(*(Price{ 2.5 } * Quantity{ 4.0 }) == 10.0);
+        static_assert(*(Timestamp{ 100 } + Duration{ 20 }) == 120);
+        static_assert(*(Duration{ 20 } * int64_t{ 3 }) == 60);
+    }
+
+    SECTION("Operations are only available in the declared order")
+    {
+        static_assert(multipliable<Price, Quantity>);
+        static_assert(!multipliable<Quantity, Price>);
+        static_assert(!addable<Price, Quantity>);
+        static_assert(!addable<Duration, Timestamp>);
+        static_assert(!multipliable<int64_t, Duration>);
+        static_assert(!multipliable<Duration, int>);
+        static_assert(!subtractable<Notional, Price>);
+    }
+
+    SECTION("Binding two operands of the same type replaces the inherited operator")
+    {
+        static_assert(std::is_same_v<decltype(Timestamp{} - Timestamp{}), Duration>);
+        static_assert(*(Timestamp{ 120 } - Timestamp{ 100 }) == 20);
+        static_assert(std::is_same_v<decltype(Timestamp{} + Timestamp{}), Timestamp>);
+        static_assert(std::is_same_v<decltype(Duration{} - Duration{}), Duration>);
+    }
+
+    SECTION("Comparisons")
+    {
+        static_assert(less_than_comparable<Price, Limit>);
+        static_assert(less_than_comparable<Limit, Price>);  // Rewritten from the bound three-way comparison
+        static_assert(!less_than_comparable<Price, Notional>);
+        static_assert(Price{ 1.0 } < Limit{ 2.0 });
+        static_assert(Limit{ 2.0 } >= Price{ 1.0 });
+        CHECK(Text{ "hello" } == std::string_view{ "hello" });
+        CHECK(std::string_view{ "hello" } != Text{ "world" });
+    }
+
+    SECTION("Bound comparisons must result in a condition")
+    {
+        static_assert(less_than_comparable<Duration, int64_t>);
+        static_assert(Duration{ 1 } < int64_t{ 2 });
+        static_assert(!less_than_comparable<Quantity, Notional>);
+        static_assert(!equal_to_comparable<Duration, int64_t>);  // Would be a rewritten candidate for !=
+        static_assert(!equal_to_comparable<int64_t, Duration>);
+    }
+
+    SECTION("Bound operations mirror the noexcept specification of the underlying operation")
+    {
+        static_assert(noexcept(Price{} * Quantity{}));
+        static_assert(noexcept(Timestamp{} - Timestamp{}));
+        static_assert(noexcept(std::declval<const Text&>() == std::string_view{}) ==
+                      noexcept(std::declval<const std::string&>() == std::string_view{}));
+    }
+}
+
+}  // namespace
+
+}  // namespace stronger::tests::bindings
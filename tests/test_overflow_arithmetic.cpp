@@ -0,0 +1,151 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <stronger.hpp>
+#include <stronger/overflow.hpp>
+#include <type_traits>
+
+namespace stronger::tests
+{
+
+namespace
+{
+
+using Cents = strong_type<int32_t, tag(), options::checked_arithmetic>;
+using Units = strong_type<uint16_t, tag(), options::checked_arithmetic>;
+using Level = strong_type<int8_t, tag(), options::saturating_arithmetic>;
+using Bytes = strong_type<uint64_t, tag(), options::saturating_arithmetic>;
+using Signal = strong_type<int64_t, tag(), options::saturating_arithmetic>;
+using Plain = strong_type<int32_t, tag()>;
+using Score = strong_type<int32_t, tag(), options::checked_arithmetic, options::allow_implicit_construction>;
+
+constexpr int32_t int32_max = std::numeric_limits<int32_t>::max();
+constexpr int32_t int32_min = std::numeric_limits<int32_t>::min();
+constexpr int64_t int64_max = std::numeric_limits<int64_t>::max();
+constexpr int64_t int64_min = std::numeric_limits<int64_t>::min();
+constexpr uint64_t uint64_max = std::numeric_limits<uint64_t>::max();
+
+template <typename T>
+concept is_constant_sum = requires { std::integral_constant<int, (T{ 1 } + T{ 1 }, 0)>{}; };
+
+TEST_CASE("Checked and saturating arithmetic")
+{
+    SECTION("Layout and exception specifications")
+    {
+        static_assert(sizeof(Cents) == sizeof(int32_t));
+        static_assert(std::is_trivially_copyable_v<Level>);
+        static_assert(!noexcept(Cents{ 1 } + Cents{ 1 }));
+        static_assert(noexcept(Level{ 1 } + Level{ 1 }));
+        static_assert(noexcept(Plain{ 1 } + Plain{ 1 }));
+        static_assert(is_constant_sum<Cents>);
+        static_assert(is_constant_sum<Level>);
+    }
+
+    SECTION("Results in range are unchanged")
+    {
+        static_assert(*(Cents{ 1200 } + Cents{ 34 }) == 1234);
+        static_assert(*(Cents{ 12 } - Cents{ 34 }) == -22);
+        static_assert(*(Cents{ -12 } * Cents{ 34 }) == -408);
+        static_assert(*(Cents{ 100 } / Cents{ -7 }) == -14);
+        static_assert(*(Cents{ 100 } % Cents{ -7 }) == 2);
+        static_assert(*(Cents{ 3 } << Cents{ 4 }) == 48);
+        static_assert(*(Cents{ -48 } >> Cents{ 4 }) == -3);
+        static_assert(*-Cents{ 5 } == -5);
+        static_assert(*(Level{ 100 } + Level{ 27 }) == 127);
+        static_assert(*(Units{ 60000 } + Units{ 5535 }) == 65535);
+    }
+
+    SECTION("Checked arithmetic throws on overflow")
+    {
+        CHECK_THROWS_AS(Cents{ int32_max } + Cents{ 1 }, std::overflow_error);
+        CHECK_THROWS_AS(Cents{ int32_min } - Cents{ 1 }, std::overflow_error);
+        CHECK_THROWS_AS(Cents{ 65536 } * Cents{ 65536 }, std::overflow_error);
+        CHECK_THROWS_AS(Cents{ int32_min } / Cents{ -1 }, std::overflow_error);
+        CHECK_THROWS_AS(-Cents{ int32_min }, std::overflow_error);
+        CHECK_THROWS_AS(Cents{ 1 } << Cents{ 31 }, std::overflow_error);
+        CHECK_THROWS_AS(Cents{ 1 } << Cents{ 32 }, std::overflow_error);
+        CHECK_THROWS_AS(Cents{ 1 } >> Cents{ -1 }, std::overflow_error);
+        CHECK_THROWS_AS(Cents{ 1 } / Cents{ 0 }, std::domain_error);
+        CHECK_THROWS_AS(Cents{ 1 } % Cents{ 0 }, std::domain_error);
+        CHECK(*(Cents{ int32_min } % Cents{ -1 }) == 0);
+        CHECK(*(Cents{ -1 } << Cents{ 31 }) == int32_min);
+
+        // Unsigned results below 0 overflow too, instead of wrapping around
+        CHECK_THROWS_AS(Units{ 1 } - Units{ 2 }, std::overflow_error);
+        CHECK_THROWS_AS(Units{ 65535 } + Units{ 1 }, std::overflow_error);
+        CHECK_THROWS_AS(Units{ 256 } * Units{ 256 }, std::overflow_error);
+        CHECK_THROWS_AS(-Units{ 1 }, std::overflow_error);
+
+        // The operand is left unchanged when a compound assignment throws
+        Cents balance{ int32_max - 1 };
+        ++balance;
+        CHECK(*balance == int32_max);
+        CHECK_THROWS_AS(++balance, std::overflow_error);
+        CHECK_THROWS_AS(balance += Cents{ 1 }, std::overflow_error);
+        CHECK_THROWS_AS(balance <<= Cents{ 1 }, std::overflow_error);
+        CHECK(*balance == int32_max);
+        balance -= Cents{ int32_max };
+        balance--;
+        CHECK(*balance == -1);
+    }
+
+    SECTION("Saturating arithmetic clamps on overflow")
+    {
+        static_assert(*(Level{ 100 } + Level{ 100 }) == 127);
+        static_assert(*(Level{ -100 } + Level{ -100 }) == -128);
+        static_assert(*(Level{ -100 } - Level{ 100 }) == -128);
+        static_assert(*(Level{ 100 } - Level{ -100 }) == 127);
+        static_assert(*(Level{ 16 } * Level{ 16 }) == 127);
+        static_assert(*(Level{ -16 } * Level{ 16 }) == -128);
+        static_assert(*(Level{ -128 } / Level{ -1 }) == 127);
+        static_assert(*-Level{ -128 } == 127);
+        static_assert(*(Level{ 1 } << Level{ 7 }) == 127);
+        static_assert(*(Level{ -1 } << Level{ 8 }) == -128);
+        static_assert(*(Level{ 0 } << Level{ 100 }) == 0);
+        static_assert(*(Level{ -100 } >> Level{ 9 }) == -1);
+        static_assert(*(Level{ 100 } >> Level{ 9 }) == 0);
+
+        static_assert(*(Bytes{ 3 } - Bytes{ 5 }) == 0);
+        static_assert(*(Bytes{ uint64_max } + Bytes{ 1 }) == uint64_max);
+        static_assert(*(Bytes{ uint64_max / 2 } * Bytes{ 3 }) == uint64_max);
+        static_assert(*-Bytes{ 3 } == 0);
+        static_assert(*(Signal{ int64_max } + Signal{ int64_max }) == int64_max);
+        static_assert(*(Signal{ int64_min } * Signal{ -1 }) == int64_max);
+
+        Level level{ 120 };
+        level += Level{ 10 };
+        CHECK(*level == 127);
+        ++level;
+        CHECK(*level == 127);
+        level *= Level{ -1 };
+        level--;
+        CHECK(*level == -128);
+        level--;
+        CHECK(*level == -128);
+    }
+
+    SECTION("Implicit construction")
+    {
+        static_assert(*(Score{ 40 } + 2) == 42);
+        static_assert(*(2 * Score{ 21 }) == 42);
+        Score score = 40;
+        score += 2;
+        CHECK(*score == 42);
+        CHECK_THROWS_AS(score * int32_max, std::overflow_error);
+    }
+
+    SECTION("Other types keep their inherited arithmetic")
+    {
+        static_assert(std::is_same_v<decltype(Plain{} + Plain{}), Plain>);
+        static_assert(*(Plain{ 5 } << Plain{ 2 }) == 20);
+    }
+}
+
+}  // namespace
+
+}  // namespace stronger::tests
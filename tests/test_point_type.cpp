@@ -0,0 +1,139 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "helpers.h"
+#include <catch2/catch_test_macros.hpp>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stronger.hpp>
+#include <stronger/point_type.hpp>
+#include <type_traits>
+
+namespace stronger::tests
+{
+
+namespace
+{
+
+using Timestamp = point_type<uint64_t, tag()>;
+using Duration = Timestamp::difference_type;
+using Offset = point_type<int64_t, tag()>;
+using Seconds = point_type<double, tag()>;
+using Address = point_type<const char*, tag()>;
+using SequenceNumber = point_type<uint16_t, tag(), options::modular>;
+using SequenceDelta = SequenceNumber::difference_type;
+
+TEST_CASE("Point types")
+{
+    SECTION("Affine operations")
+    {
+        static_assert(std::is_same_v<Duration, strong_type<int64_t, traits::point_type_info<Timestamp>::tag>>);
+        static_assert(std::is_same_v<decltype(Timestamp{} - Timestamp{}), Duration>);
+        static_assert(std::is_same_v<decltype(Timestamp{} + Duration{}), Timestamp>);
+        static_assert(std::is_same_v<decltype(Duration{} + Timestamp{}), Timestamp>);
+        static_assert(std::is_same_v<decltype(Timestamp{} - Duration{}), Timestamp>);
+        static_assert(std::is_same_v<decltype(Duration{} + Duration{}), Duration>);
+        static_assert(!addable<Timestamp, Timestamp>);
+        static_assert(!addable<Timestamp, uint64_t>);
+        static_assert(!addable<Timestamp, Offset::difference_type>);
+        static_assert(!subtractable<Timestamp, Offset>);
+        static_assert(!subtractable<Duration, Timestamp>);
+    }
+
+    SECTION("Differences are signed")
+    {
+        static_assert(*(Timestamp{ 10 } - Timestamp{ 15 }) == -5);
+        static_assert(*(Timestamp{ 15 } - Timestamp{ 10 }) == 5);
+        static_assert(*(Timestamp{ 15 } + Duration{ -10 }) == 5);
+        static_assert(*(Timestamp{ 15 } - Duration{ -10 }) == 25);
+        static_assert(*(Offset{ -3 } - Offset{ 4 }) == -7);
+        static_assert(*(Seconds{ 1.5 } - Seconds{ 0.5 }) == 1.0);
+    }
+
+    SECTION("Pointers")
+    {
+        static constexpr char text[] = "hello";
+        static_assert(std::is_same_v<Address::difference_type,
+                                     strong_type<std::ptrdiff_t, traits::point_type_info<Address>::tag>>);
+        static_assert(*(Address{ text + 4 } - Address{ text }) == 4);
+        static_assert(*(Address{ text } + Address::difference_type{ 1 }) == text + 1);
+    }
+
+    SECTION("Compound assignments and increments")
+    {
+        Timestamp timestamp{ 100 };
+        timestamp += Duration{ 20 };
+        CHECK(*timestamp == 120);
+        timestamp -= Duration{ 30 };
+        CHECK(*timestamp == 90);
+        CHECK(*timestamp++ == 90);
+        CHECK(*++timestamp == 92);
+        CHECK(*timestamp-- == 92);
+        CHECK(*--timestamp == 90);
+    }
+
+    SECTION("Comparisons")
+    {
+        static_assert(Timestamp{ 1 } < Timestamp{ 2 });
+        static_assert(Timestamp{ 2 } == Timestamp{ 2 });
+        static_assert(Timestamp{ std::numeric_limits<uint64_t>::max() } > Timestamp{ 0 });
+        static_assert(std::is_same_v<decltype(Timestamp{} <=> Timestamp{}), std::strong_ordering>);
+        static_assert(std::is_same_v<decltype(Seconds{} <=> Seconds{}), std::partial_ordering>);
+    }
+
+    SECTION("Modular points wrap around")
+    {
+        static_assert(std::is_same_v<SequenceDelta::underlying_type, int16_t>);
+        static_assert(*(SequenceNumber{ 65535 } + SequenceDelta{ 1 }) == 0);
+        static_assert(*(SequenceNumber{ 0 } - SequenceDelta{ 1 }) == 65535);
+        static_assert(*(SequenceNumber{ 2 } - SequenceNumber{ 65534 }) == 4);
+        static_assert(*(SequenceNumber{ 65534 } - SequenceNumber{ 2 }) == -4);
+
+        // Serial number arithmetic: 65535 is just before 0
+        static_assert(SequenceNumber{ 65535 } < SequenceNumber{ 0 });
+        static_assert(SequenceNumber{ 0 } > SequenceNumber{ 65535 });
+        static_assert(SequenceNumber{ 100 } < SequenceNumber{ 200 });
+        static_assert(SequenceNumber{ 200 } > SequenceNumber{ 100 });
+        static_assert(SequenceNumber{ 1000 } > SequenceNumber{ 40000 });
+        static_assert(std::is_same_v<decltype(SequenceNumber{} <=> SequenceNumber{}), std::partial_ordering>);
+
+        // Half the range apart, each point is as much ahead of the other as behind it
+        static_assert((SequenceNumber{ 0 } <=> SequenceNumber{ 32768 }) == std::partial_ordering::unordered);
+        static_assert((SequenceNumber{ 32768 } <=> SequenceNumber{ 0 }) == std::partial_ordering::unordered);
+        static_assert(!(SequenceNumber{ 0 } < SequenceNumber{ 32768 }));
+        static_assert(!(SequenceNumber{ 32768 } < SequenceNumber{ 0 }));
+        static_assert(SequenceNumber{ 0 } < SequenceNumber{ 32767 });
+        static_assert(SequenceNumber{ 0 } > SequenceNumber{ 32769 });
+
+        SequenceNumber sequence{ 65535 };
+        ++sequence;
+        CHECK(*sequence == 0);
+        --sequence;
+        CHECK(*sequence == 65535);
+    }
+
+    SECTION("Points have the layout of their underlying type")
+    {
+        static_assert(sizeof(Timestamp) == sizeof(uint64_t));
+        static_assert(sizeof(SequenceNumber) == sizeof(uint16_t));
+        static_assert(alignof(Timestamp) == alignof(uint64_t));
+        static_assert(std::is_trivially_copyable_v<Timestamp>);
+        static_assert(std::is_standard_layout_v<Timestamp>);
+        static_assert(std::is_trivially_default_constructible_v<Timestamp>);
+        static_assert(traits::is_point_type<Timestamp>);
+        static_assert(!traits::is_point_type<Duration>);
+    }
+
+    SECTION("Noexcept")
+    {
+        static_assert(noexcept(Timestamp{} - Timestamp{}));
+        static_assert(noexcept(Timestamp{} + Duration{}));
+        static_assert(noexcept(SequenceNumber{} < SequenceNumber{}));
+    }
+}
+
+}  // namespace
+
+}  // namespace stronger::tests
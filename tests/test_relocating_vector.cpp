@@ -0,0 +1,215 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <stronger.hpp>
+#include <stronger/containers/relocating_vector.hpp>
+#include <type_traits>
+
+namespace
+{
+
+/// Counts its live instances and the calls to its move constructor
+struct counted
+{
+    static inline int instances = 0;
+    static inline int moves = 0;
+
+    int value = 0;
+
+    explicit counted(const int v) noexcept : value(v) { ++instances; }
+
+    counted(const counted& other) noexcept : value(other.value) { ++instances; }
+
+    counted(counted&& other) noexcept : value(other.value)
+    {
+        ++instances;
+        ++moves;
+    }
+
+    counted& operator=(const counted&) = default;
+    counted& operator=(counted&&) = default;
+
+    ~counted() { --instances; }
+};
+
+/// Same as counted, but declared trivially relocatable
+struct relocatable_counted : counted
+{
+    using counted::counted;
+};
+
+/// Points to itself: copying its bytes would make it point to the previous storage
+struct self_referencing
+{
+    self_referencing() noexcept = default;
+
+    self_referencing(const self_referencing&) noexcept {}
+
+    self_referencing& operator=(const self_referencing&) noexcept { return *this; }
+
+    ~self_referencing() = default;
+
+    [[nodiscard]] bool valid() const noexcept { return self == this; }
+
+    const self_referencing* self = this;
+};
+
+/// Copying it throws once `copies` reaches 0
+struct throwing_copy
+{
+    static inline int copies = 0;
+    static inline int instances = 0;
+
+    int value = 0;
+
+    explicit throwing_copy(const int v) noexcept : value(v) { ++instances; }
+
+    throwing_copy(const throwing_copy& other) : value(other.value)
+    {
+        if(copies-- == 0)
+            throw std::runtime_error("copy");
+        ++instances;
+    }
+
+    throwing_copy& operator=(const throwing_copy&) = default;
+    ~throwing_copy() { --instances; }
+};
+
+}  // namespace
+
+template <>
+struct stronger::is_trivially_relocatable<relocatable_counted> : std::true_type
+{
+};
+
+namespace stronger::tests
+{
+
+namespace
+{
+
+using Handle = strong_type<std::unique_ptr<int>, tag()>;
+using Counter = strong_type<relocatable_counted, tag()>;
+
+TEST_CASE("Relocating vectors")
+{
+    SECTION("Trait")
+    {
+        static_assert(is_trivially_relocatable_v<int>);
+        static_assert(is_trivially_relocatable_v<strong_type<double, tag()>>);
+        static_assert(is_trivially_relocatable_v<std::unique_ptr<int>>);
+        static_assert(is_trivially_relocatable_v<Handle>);
+        static_assert(is_trivially_relocatable_v<strong_type<std::shared_ptr<int>, tag()>>);
+        static_assert(is_trivially_relocatable_v<Counter>);
+        static_assert(!is_trivially_relocatable_v<counted>);
+        static_assert(!is_trivially_relocatable_v<strong_type<counted, tag()>>);
+        static_assert(!is_trivially_relocatable_v<self_referencing>);
+        static_assert(!is_trivially_relocatable_v<strong_type<self_referencing, tag()>>);
+    }
+
+    SECTION("Growth and erasure of trivially relocatable elements")
+    {
+        relocating_vector<Handle> handles;
+        for(int i = 0; i < 100; ++i)
+            handles.emplace_back(std::make_unique<int>(i));
+        CHECK(handles.size() == 100);
+        CHECK(handles.capacity() >= 100);
+        CHECK(**handles[42] == 42);
+
+        handles.erase(handles.begin() + 10, handles.begin() + 20);
+        handles.erase(handles.begin());
+        CHECK(handles.size() == 89);
+        CHECK(**handles.front() == 1);
+        CHECK(**handles[9] == 20);
+        CHECK(**handles.back() == 99);
+
+        relocating_vector<Handle> moved = std::move(handles);
+        CHECK(handles.empty());
+        CHECK(moved.size() == 89);
+        moved.pop_back();
+        moved.clear();
+        CHECK(moved.empty());
+    }
+
+    SECTION("Trivially relocatable elements are not moved")
+    {
+        counted::moves = 0;
+        {
+            relocating_vector<Counter> counters;
+            for(int i = 0; i < 1000; ++i)
+                counters.emplace_back(std::in_place, i);
+            counters.erase(counters.begin() + 1);
+            CHECK(counters[1]->value == 2);
+            CHECK(counted::instances == 999);
+        }
+        CHECK(counted::moves == 0);
+        CHECK(counted::instances == 0);
+    }
+
+    SECTION("Other elements are moved")
+    {
+        relocating_vector<self_referencing> values;
+        for(int i = 0; i < 100; ++i)
+            values.emplace_back();
+        values.erase(values.begin() + 5);
+        for(const self_referencing& value : values)
+            CHECK(value.valid());
+
+        counted::moves = 0;
+        {
+            relocating_vector<strong_type<counted, tag()>> counters;
+            for(int i = 0; i < 100; ++i)
+                counters.emplace_back(std::in_place, i);
+            counters.erase(counters.begin(), counters.begin() + 50);
+            CHECK(counters.front()->value == 50);
+            CHECK(counted::instances == 50);
+        }
+        CHECK(counted::moves > 0);
+        CHECK(counted::instances == 0);
+    }
+
+    SECTION("Copies and exception safety")
+    {
+        const relocating_vector<std::string> strings = { "a", "b", "c" };
+        relocating_vector<std::string> copy = strings;
+        CHECK(copy == strings);
+        copy.push_back(copy.front());
+        CHECK(copy.size() == 4);
+        CHECK(copy.back() == "a");
+
+        relocating_vector<throwing_copy> values;
+        throwing_copy::copies = 100;
+        for(int i = 0; i < 8; ++i)
+            values.emplace_back(i);
+        throwing_copy::copies = 3;
+        CHECK_THROWS_AS(values.emplace_back(8), std::runtime_error);
+        CHECK(values.size() == 8);
+        CHECK(values.capacity() == 8);
+        CHECK(values.back().value == 7);
+    }
+
+    SECTION("Constructors release what they built when a copy throws")
+    {
+        throwing_copy::copies = 100;
+        const relocating_vector<throwing_copy> values = { throwing_copy{ 0 }, throwing_copy{ 1 }, throwing_copy{ 2 } };
+        const int instances = throwing_copy::instances;
+
+        throwing_copy::copies = 1;
+        CHECK_THROWS_AS(relocating_vector<throwing_copy>(values), std::runtime_error);
+        CHECK(throwing_copy::instances == instances);
+
+        throwing_copy::copies = 1;
+        CHECK_THROWS_AS((relocating_vector<throwing_copy>{ throwing_copy{ 3 }, throwing_copy{ 4 }, throwing_copy{ 5 } }),
+                        std::runtime_error);
+        CHECK(throwing_copy::instances == instances);
+    }
+}
+
+}  // namespace
+
+}  // namespace stronger::tests
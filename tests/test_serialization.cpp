@@ -0,0 +1,173 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include <algorithm>
+#include <bit>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <stronger.hpp>
+#include <stronger/serialization.hpp>
+#include <vector>
+
+namespace
+{
+
+/// Serialized as its amount only
+struct Order
+{
+    int32_t amount = 0;
+    std::string comment;
+};
+
+struct Point
+{
+    float x = 0.0F;
+    float y = 0.0F;
+};
+
+}  // namespace
+
+template <>
+struct stronger::serializer<Order>
+{
+    template <std::endian Order_>
+    static void serialize(std::vector<std::byte>& out, const Order& value)
+    {
+        stronger::serialize<Order_>(out, value.amount);
+    }
+
+    template <std::endian Order_>
+    static Order deserialize(std::span<const std::byte>& in)
+    {
+        return Order{ stronger::deserialize<int32_t, Order_>(in), {} };
+    }
+};
+
+namespace stronger::tests
+{
+
+namespace
+{
+
+using Price = strong_type<double, tag()>;
+using Count = strong_type<uint16_t, tag()>;
+using Prices = strong_type<std::vector<Price>, tag()>;
+using Name = strong_type<std::string, tag()>;
+using Orders = strong_type<std::vector<Order>, tag()>;
+using Position = strong_type<Point, tag()>;
+using Flag = strong_type<bool, tag()>;
+
+template <std::endian Order = std::endian::native, typename T>
+std::vector<std::byte> bytes_of(const T& value)
+{
+    std::vector<std::byte> out;
+    serialize<Order>(out, value);
+    return out;
+}
+
+template <typename T, std::endian Order = std::endian::native>
+T round_trip(const T& value)
+{
+    const std::vector<std::byte> bytes = bytes_of<Order>(value);
+    std::span<const std::byte> in = bytes;
+    T result = deserialize<T, Order>(in);
+    CHECK(in.empty());
+    return result;
+}
+
+template <std::endian Order, typename T>
+concept serializable_in = requires(std::vector<std::byte>& out, const T& value) { serialize<Order>(out, value); };
+
+TEST_CASE("Serialization")
+{
+    SECTION("Types")
+    {
+        static_assert(concepts::serializable<Price>);
+        static_assert(concepts::deserializable<Prices>);
+        static_assert(concepts::serializable<std::span<const Price>>);
+        static_assert(!concepts::deserializable<std::span<const Price>>);
+        static_assert(concepts::deserializable<std::list<Count>>);
+        static_assert(concepts::deserializable<Orders>);
+        static_assert(concepts::deserializable<Flag>);
+        static_assert(serializable_in<std::endian::native, Position>);
+        static_assert(!serializable_in<std::endian::little, Position> ||
+                      !serializable_in<std::endian::big, Position>);  // Structs are only copied in the native order
+        static_assert(serializable_in<std::endian::big, std::vector<Count>>);
+        static_assert(!concepts::serializable<int*>);
+    }
+
+    SECTION("Byte order")
+    {
+        const std::vector<std::byte> big = bytes_of<std::endian::big>(Count{ 0x0102 });
+        CHECK(big == std::vector{ std::byte{ 1 }, std::byte{ 2 } });
+        const std::vector<std::byte> little = bytes_of<std::endian::little>(Count{ 0x0102 });
+        CHECK(little == std::vector{ std::byte{ 2 }, std::byte{ 1 } });
+
+        const std::vector<Count> counts = { Count{ 0x0102 }, Count{ 0x0304 } };
+        const std::vector<std::byte> bulk = bytes_of<std::endian::big>(std::span{ counts });
+        REQUIRE(bulk.size() == 12);
+        CHECK(bulk[7] == std::byte{ 2 });
+        const std::vector elements = { std::byte{ 1 }, std::byte{ 2 }, std::byte{ 3 }, std::byte{ 4 } };
+        CHECK(std::ranges::equal(std::span{ bulk }.subspan(8), elements));
+    }
+
+    SECTION("Round trips")
+    {
+        CHECK(round_trip(Price{ 12.5 }) == Price{ 12.5 });
+        CHECK((round_trip<Price, std::endian::big>(Price{ -0.75 })) == Price{ -0.75 });
+        CHECK(round_trip(Flag{ true }) == Flag{ true });
+        CHECK(round_trip(Name{ "Alice" }) == Name{ "Alice" });
+
+        const Prices prices{ std::vector{ Price{ 1.0 }, Price{ 2.5 }, Price{ -3.0 } } };
+        CHECK(round_trip(prices) == prices);
+        CHECK((round_trip<Prices, std::endian::big>(prices)) == prices);
+        CHECK((round_trip<Prices, std::endian::little>(prices)) == prices);
+        CHECK(round_trip(Prices{}) == Prices{});
+
+        const std::list<Count> counts = { Count{ 1 }, Count{ 2 } };
+        CHECK((round_trip<std::list<Count>, std::endian::big>(counts)) == counts);
+
+        const std::vector<std::vector<Count>> nested = { { Count{ 1 } }, {}, { Count{ 2 }, Count{ 3 } } };
+        CHECK(round_trip(nested) == nested);
+
+        const Position position{ Point{ 1.5F, -2.0F } };
+        CHECK(round_trip(position)->y == -2.0F);
+    }
+
+    SECTION("Customization")
+    {
+        const Orders orders{ std::vector{ Order{ 5, "first" }, Order{ -7, "second" } } };
+        const std::vector<std::byte> bytes = bytes_of<std::endian::big>(orders);
+        CHECK(bytes.size() == 8 + 2 * sizeof(int32_t));
+        std::span<const std::byte> in = bytes;
+        const Orders result = deserialize<Orders, std::endian::big>(in);
+        REQUIRE(result->size() == 2);
+        CHECK((*result)[1].amount == -7);
+        CHECK((*result)[1].comment.empty());
+    }
+
+    SECTION("Truncated input")
+    {
+        std::vector<std::byte> bytes = bytes_of(Prices{ std::vector{ Price{ 1.0 }, Price{ 2.0 } } });
+        bytes.pop_back();
+        std::span<const std::byte> in = bytes;
+        CHECK_THROWS_AS(deserialize<Prices>(in), std::out_of_range);
+
+        // A corrupted size does not allocate
+        std::vector<std::byte> corrupted = bytes_of(uint64_t{ 1 } << 60);
+        std::span<const std::byte> corruptedIn = corrupted;
+        CHECK_THROWS_AS(deserialize<std::vector<std::string>>(corruptedIn), std::out_of_range);
+
+        std::span<const std::byte> empty;
+        CHECK_THROWS_AS(deserialize<Count>(empty), std::out_of_range);
+    }
+}
+
+}  // namespace
+
+}  // namespace stronger::tests
@@ -0,0 +1,99 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include <stronger.hpp>
+#include <stronger/simd.hpp>
+
+#if __has_include(<experimental/simd>)
+#include "helpers.h"
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <span>
+#include <utility>
+
+namespace stronger::tests
+{
+
+namespace
+{
+
+namespace stdx = std::experimental;
+
+using Meters = strong_type<double, tag()>;
+using Seconds = strong_type<double, tag()>;
+using Count = strong_type<int, tag()>;
+using MetersBatch = simd_of<Meters>;
+using SecondsBatch = simd_of<Seconds>;
+
+constexpr size_t Width = MetersBatch::underlying_type::size();
+
+TEST_CASE("SIMD batches of strong types")
+{
+    SECTION("Batches keep the tag of their scalar type")
+    {
+        static_assert(std::is_same_v<MetersBatch::underlying_type, stdx::native_simd<double>>);
+        static_assert(std::is_same_v<traits::simd_info<MetersBatch>::scalar_type, Meters>);
+        static_assert(!std::is_same_v<MetersBatch, SecondsBatch>);
+        static_assert(addable<MetersBatch, MetersBatch>);
+        static_assert(!addable<MetersBatch, SecondsBatch>);
+        static_assert(!addable<MetersBatch, stdx::native_simd<double>>);
+        static_assert(concepts::strong_simd<MetersBatch>);
+        static_assert(!concepts::strong_simd<Meters>);
+        static_assert(!concepts::strong_simd_scalar<strong_type<bool, tag()>>);
+    }
+
+    SECTION("Comparisons and negation return masks")
+    {
+        static_assert(concepts::supports_less_than<stdx::native_simd<double>>);
+        static_assert(concepts::supports_negation<stdx::native_simd<int>>);
+
+        const MetersBatch a{ 1.0 };
+        const MetersBatch b{ 2.0 };
+        static_assert(std::is_same_v<decltype(a < b), stdx::native_simd_mask<double>>);
+        CHECK(all_of(a < b));
+        CHECK(none_of(a == b));
+        CHECK(all_of(a != b));
+        CHECK(all_of(!simd_of<Count>{ 0 }));
+    }
+
+    SECTION("Arithmetic, load, store and reduction")
+    {
+        std::array<Meters, Width> positions{};
+        std::array<Meters, Width> offsets{};
+        for(size_t i = 0; i < Width; ++i)
+        {
+            positions[i] = Meters{ static_cast<double>(i) };
+            offsets[i] = Meters{ 0.5 };
+        }
+
+        const MetersBatch batch = load_simd(std::span{ std::as_const(positions) }) + load_simd(std::span{ offsets });
+        store_simd(batch, std::span{ positions });
+        for(size_t i = 0; i < Width; ++i)
+            CHECK(positions[i] == Meters{ static_cast<double>(i) + 0.5 });
+
+        const double sum = static_cast<double>(Width * (Width - 1) / 2) + 0.5 * static_cast<double>(Width);
+        CHECK(reduce(batch) == Meters{ sum });
+        CHECK(hmin(batch) == Meters{ 0.5 });
+        CHECK(hmax(batch) == Meters{ static_cast<double>(Width) - 0.5 });
+    }
+
+    SECTION("Masked assignment")
+    {
+        MetersBatch batch{ 3.0 };
+        const MetersBatch limit{ 2.0 };
+        where(batch > limit, batch) = limit;
+        CHECK(all_of(batch == limit));
+
+        where(batch < MetersBatch{ 0.0 }, batch) += limit;
+        CHECK(all_of(batch == limit));
+
+        where(batch == limit, batch) *= limit;
+        CHECK(reduce(batch) == Meters{ 4.0 * static_cast<double>(Width) });
+    }
+}
+
+}  // namespace
+
+}  // namespace stronger::tests
+
+#endif
@@ -0,0 +1,171 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <stronger.hpp>
+#include <stronger/containers/soa_vector.hpp>
+#include <tuple>
+#include <type_traits>
+
+namespace stronger::tests
+{
+
+namespace
+{
+
+using Price = strong_type<double, tag()>;
+using Quantity = strong_type<int64_t, tag()>;
+using OrderId = strong_type<uint32_t, tag()>;
+using Trader = strong_type<std::string, tag()>;
+using Book = soa_vector<Price, Quantity, OrderId>;
+
+/// Throws on construction from a negative value
+struct Fragile
+{
+    explicit Fragile(const int initial) :
+            value(initial)
+    {
+        if(initial < 0)
+            throw std::invalid_argument("negative");
+    }
+
+    int value;
+    bool operator==(const Fragile&) const = default;
+};
+
+template <typename Vector, typename Field>
+concept has_column = requires(Vector& vector) { vector.template column<Field>(); };
+
+TEST_CASE("Structure of arrays")
+{
+    SECTION("Types")
+    {
+        static_assert(std::ranges::random_access_range<Book>);
+        static_assert(std::ranges::random_access_range<const Book>);
+        static_assert(std::ranges::sized_range<Book>);
+        static_assert(std::random_access_iterator<Book::iterator>);
+        static_assert(std::random_access_iterator<Book::const_iterator>);
+        static_assert(std::is_convertible_v<Book::iterator, Book::const_iterator>);
+        static_assert(!std::is_convertible_v<Book::const_iterator, Book::iterator>);
+        static_assert(std::is_same_v<std::ranges::range_reference_t<Book>, std::tuple<Price&, Quantity&, OrderId&>>);
+        static_assert(std::is_same_v<decltype(std::declval<Book&>().column<Quantity>()), std::span<Quantity>>);
+        static_assert(
+            std::is_same_v<decltype(std::declval<const Book&>().column<Quantity>()), std::span<const Quantity>>);
+        static_assert(has_column<Book, Price>);
+        static_assert(!has_column<Book, Trader>);
+        static_assert(!has_column<Book, double>);
+    }
+
+    SECTION("Columns are contiguous")
+    {
+        Book book;
+        book.reserve(3);
+        CHECK(book.capacity() >= 3);
+        book.push_back(Price{ 10.5 }, Quantity{ 3 }, OrderId{ 1 });
+        book.emplace_back(11.0, 5, 2U);
+        book.push_back({ Price{ 9.75 }, Quantity{ 7 }, OrderId{ 3 } });
+
+        REQUIRE(book.size() == 3);
+        const std::span<Quantity> quantities = book.column<Quantity>();
+        CHECK(quantities.size() == 3);
+        CHECK(std::accumulate(quantities.begin(), quantities.end(), int64_t{ 0 },
+                              [](const int64_t sum, const Quantity quantity) { return sum + *quantity; }) == 15);
+        CHECK(&quantities[1] == &quantities[0] + 1);
+        quantities[2] = Quantity{ 8 };
+        CHECK(*std::get<Quantity&>(book[2]) == 8);
+    }
+
+    SECTION("Rows")
+    {
+        Book book = {
+            { Price{ 10.5 }, Quantity{ 3 }, OrderId{ 1 } },
+            { Price{ 11.0 }, Quantity{ 5 }, OrderId{ 2 } },
+        };
+
+        auto [price, quantity, id] = book[1];
+        CHECK(*price == 11.0);
+        quantity = Quantity{ 6 };
+        CHECK(*book.column<Quantity>()[1] == 6);
+        CHECK(*std::get<OrderId&>(book.front()) == 1);
+        CHECK(*std::get<OrderId&>(book.back()) == 2);
+
+        int64_t total = 0;
+        for(const auto& [rowPrice, rowQuantity, rowId] : std::as_const(book))
+            total += *rowQuantity;
+        CHECK(total == 9);
+
+        // Rows can be sorted like records, and the columns follow
+        std::ranges::sort(book, std::ranges::greater{}, [](const auto& row) { return *std::get<0>(row); });
+        CHECK(*book.column<OrderId>()[0] == 2);
+        CHECK(*book.column<Quantity>()[0] == 6);
+    }
+
+    SECTION("Iterators")
+    {
+        Book book = {
+            { Price{ 1.0 }, Quantity{ 1 }, OrderId{ 1 } },
+            { Price{ 2.0 }, Quantity{ 2 }, OrderId{ 2 } },
+            { Price{ 3.0 }, Quantity{ 3 }, OrderId{ 3 } },
+        };
+
+        auto it = book.begin();
+        CHECK(book.end() - it == 3);
+        CHECK(*std::get<Price&>(it[2]) == 3.0);
+        it += 2;
+        CHECK(*std::get<Price&>(*it) == 3.0);
+        --it;
+        CHECK(*std::get<Price&>(*it) == 2.0);
+        CHECK(it < book.end());
+        const Book::const_iterator constIt = it;
+        CHECK(constIt == it);
+
+        // Iterators hold positions: they stay valid when the columns reallocate
+        book.reserve(100);
+        CHECK(*std::get<Price&>(*it) == 2.0);
+
+        // Rows are swapped and moved field by field
+        using rvalue_reference = std::tuple<Price&&, Quantity&&, OrderId&&>;
+        static_assert(std::is_same_v<decltype(std::ranges::iter_move(it)), rvalue_reference>);
+        std::ranges::iter_swap(book.begin(), it);
+        CHECK(*book.column<OrderId>()[0] == 2);
+        CHECK(*book.column<OrderId>()[1] == 1);
+    }
+
+    SECTION("Modifiers")
+    {
+        Book book;
+        book.resize(4);
+        CHECK(book.size() == 4);
+        CHECK(book.column<Price>().size() == 4);
+        book.pop_back();
+        CHECK(book.column<OrderId>().size() == 3);
+        const Book copy = book;
+        CHECK(copy == book);
+        book.clear();
+        CHECK(book.empty());
+        CHECK(copy != book);
+    }
+
+    SECTION("Failed insertions leave the vector unchanged")
+    {
+        soa_vector<Trader, Fragile> vector;
+        vector.emplace_back("Alice", 1);
+        CHECK_THROWS_AS(vector.emplace_back("Bob", -1), std::invalid_argument);
+        CHECK(vector.size() == 1);
+        CHECK(vector.column<Trader>().size() == 1);
+        CHECK(*vector.column<Trader>()[0] == "Alice");
+    }
+}
+
+}  // namespace
+
+}  // namespace stronger::tests
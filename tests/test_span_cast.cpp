@@ -0,0 +1,95 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <stronger.hpp>
+#include <stronger/containers/strong_span.hpp>
+#include <stronger/overflow.hpp>
+#include <stronger/span_cast.hpp>
+#include <type_traits>
+#include <vector>
+
+namespace stronger::tests
+{
+
+namespace
+{
+
+using Amount = strong_type<double, tag()>;
+using Count = strong_type<uint32_t, tag()>;
+using Level = strong_type<int8_t, tag(), options::saturating_arithmetic>;
+
+template <typename S, typename Span>
+concept can_view_as_strong = requires(Span values) { as_strong_span<S>(values); };
+
+template <typename Span>
+concept can_view_as_underlying = requires(Span values) { as_underlying_span(values); };
+
+TEST_CASE("Span casts")
+{
+    SECTION("Types")
+    {
+        using strong_span_of_double = decltype(as_strong_span<Amount>(std::declval<std::span<double>>()));
+        static_assert(std::is_same_v<strong_span_of_double, std::span<Amount>>);
+        using strong_span_of_const = decltype(as_strong_span<Amount>(std::declval<std::span<const double>>()));
+        static_assert(std::is_same_v<strong_span_of_const, std::span<const Amount>>);
+        using strong_span_of_array = decltype(as_strong_span<Count>(std::declval<std::span<uint32_t, 4>>()));
+        static_assert(std::is_same_v<strong_span_of_array, std::span<Count, 4>>);
+
+        using underlying_span = decltype(as_underlying_span(std::declval<std::span<Amount>>()));
+        static_assert(std::is_same_v<underlying_span, std::span<double>>);
+        using underlying_span_of_const = decltype(as_underlying_span(std::declval<std::span<const Amount>>()));
+        static_assert(std::is_same_v<underlying_span_of_const, std::span<const double>>);
+        using underlying_span_of_array = decltype(as_underlying_span(std::declval<std::span<const Count, 4>>()));
+        static_assert(std::is_same_v<underlying_span_of_array, std::span<const uint32_t, 4>>);
+
+        static_assert(can_view_as_strong<Level, std::span<int8_t>>);
+        static_assert(!can_view_as_strong<Amount, std::span<float>>);
+        static_assert(!can_view_as_strong<Count, std::span<int32_t>>);
+        static_assert(!can_view_as_strong<double, std::span<double>>);
+        static_assert(!can_view_as_underlying<std::span<double>>);
+    }
+
+    SECTION("Mutable spans")
+    {
+        std::vector<double> buffer = { 1.5, 2.0, 3.5 };
+        const std::span<Amount> amounts = as_strong_span<Amount>(std::span{ buffer });
+        REQUIRE(amounts.size() == 3);
+        CHECK(static_cast<void*>(amounts.data()) == static_cast<void*>(buffer.data()));
+        CHECK(*amounts[2] == 3.5);
+        amounts[0] += Amount{ 1.0 };
+
+        const std::span<double> values = as_underlying_span(amounts);
+        CHECK(values.data() == buffer.data());
+        CHECK(std::accumulate(values.begin(), values.end(), 0.0) == 8.0);
+        values[1] = 4.0;
+        CHECK(buffer[1] == 4.0);
+    }
+
+    SECTION("Const spans")
+    {
+        const std::array<uint32_t, 3> buffer = { 1, 2, 3 };
+        const std::span<const Count, 3> counts = as_strong_span<Count>(std::span{ buffer });
+        CHECK(*counts[1] == 2);
+        CHECK(*(counts[0] + counts[2]) == 4);
+
+        const std::span<const uint32_t, 3> values = as_underlying_span(counts);
+        CHECK(values.data() == buffer.data());
+        CHECK(values[2] == 3);
+    }
+
+    SECTION("Empty spans")
+    {
+        CHECK(as_strong_span<Amount>(std::span<double>{}).empty());
+        CHECK(as_underlying_span(std::span<const Count>{}).empty());
+    }
+}
+
+}  // namespace
+
+}  // namespace stronger::tests
@@ -0,0 +1,128 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "helpers.h"
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <stdexcept>
+#include <stronger.hpp>
+#include <stronger/containers/strong_array.hpp>
+#include <stronger/containers/strong_span.hpp>
+#include <stronger/containers/strong_vector.hpp>
+#include <string>
+#include <vector>
+
+namespace stronger::tests
+{
+
+namespace
+{
+
+using UserId = strong_type<uint32_t, tag()>;
+using OrderId = strong_type<uint32_t, tag()>;
+using Position = strong_type<size_t, tag()>;
+
+template <typename Container, typename Index>
+concept subscriptable_by = requires(Container c, Index i) { c[i]; };
+
+TEST_CASE("strong_vector")
+{
+    using Names = strong_vector<UserId, std::string>;
+
+    SECTION("Only subscriptable by its index type")
+    {
+        static_assert(subscriptable_by<Names, UserId>);
+        static_assert(!subscriptable_by<Names, OrderId>);
+        static_assert(!subscriptable_by<Names, uint32_t>);
+        static_assert(!subscriptable_by<Names, size_t>);
+        static_assert(std::is_same_v<decltype(std::declval<Names&>()[UserId{ 0U }]), std::string&>);
+        static_assert(std::is_same_v<decltype(std::declval<const Names&>()[UserId{ 0U }]), const std::string&>);
+    }
+
+    SECTION("Size is an index")
+    {
+        static_assert(std::is_same_v<decltype(std::declval<Names>().size()), UserId>);
+        static_assert([]
+        {
+            strong_vector<Position, int> values(Position{ 3ULL }, 7);
+            values.push_back(8);
+            return values.size() == Position{ 4ULL } && values[Position{ 2ULL }] == 7 && values[Position{ 3ULL }] == 8;
+        }());
+    }
+
+    SECTION("Iteration yields (index, value) pairs")
+    {
+        static_assert([]
+        {
+            const strong_vector<UserId, int> values = { 10, 11, 12 };
+            uint32_t expectedIndex = 0;
+            for(const auto& [index, value] : values)
+            {
+                if(index != UserId{ expectedIndex } || value != 10 + static_cast<int>(expectedIndex))
+                    throw assertion_error("Unexpected (index, value) pair");
+                ++expectedIndex;
+            }
+            return expectedIndex == 3;
+        }());
+    }
+
+    SECTION("Values can be modified through iteration")
+    {
+        static_assert([]
+        {
+            strong_vector<UserId, int> values = { 1, 2, 3 };
+            for(auto [index, value] : values)
+                value = static_cast<int>(*index) * 2;
+            return values[UserId{ 0U }] == 0 && values[UserId{ 1U }] == 2 && values[UserId{ 2U }] == 4;
+        }());
+    }
+
+    SECTION("Bounds checking is opt-in")
+    {
+        strong_vector<UserId, int, options::bounds_checked> checked = { 1, 2, 3 };
+        CHECK(checked[UserId{ 2U }] == 3);
+        CHECK_THROWS_AS(checked[UserId{ 3U }], std::out_of_range);
+    }
+}
+
+TEST_CASE("strong_array")
+{
+    using Scores = strong_array<UserId, int, 3>;
+    static_assert(subscriptable_by<Scores, UserId>);
+    static_assert(!subscriptable_by<Scores, OrderId>);
+    static_assert(!subscriptable_by<Scores, size_t>);
+    static_assert(sizeof(Scores) == sizeof(std::array<int, 3>));
+
+    static_assert([]
+    {
+        Scores scores;
+        scores.fill(5);
+        scores[UserId{ 1U }] = 6;
+        return scores.size() == UserId{ 3U } && scores[UserId{ 0U }] == 5 && scores[UserId{ 1U }] == 6;
+    }());
+}
+
+TEST_CASE("strong_span")
+{
+    static_assert(!subscriptable_by<strong_span<UserId, int>, OrderId>);
+    static_assert(!subscriptable_by<strong_span<UserId, int>, size_t>);
+    static_assert(std::is_convertible_v<strong_vector<UserId, int>&, strong_span<UserId, int>>);
+    static_assert(std::is_convertible_v<const strong_vector<UserId, int>&, strong_span<UserId, const int>>);
+    static_assert(!std::is_convertible_v<const strong_vector<UserId, int>&, strong_span<UserId, int>>);
+    static_assert(!std::is_convertible_v<strong_vector<OrderId, int>&, strong_span<UserId, int>>);
+
+    static_assert([]
+    {
+        strong_vector<UserId, int> values = { 1, 2, 3 };
+        const strong_span<UserId, int> view = values;
+        view[UserId{ 0U }] = 4;
+
+        strong_array<UserId, int, 2> array;
+        const strong_span<UserId, const int> arrayView = array;
+        return values[UserId{ 0U }] == 4 && view.size() == UserId{ 3U } && arrayView.size() == UserId{ 2U };
+    }());
+}
+
+}  // namespace
+
+}  // namespace stronger::tests
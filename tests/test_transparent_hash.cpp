@@ -0,0 +1,106 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <string_view>
+#include <stronger.hpp>
+#include <stronger/transparent_hash.hpp>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+namespace stronger::tests
+{
+
+/// Hashed by a function that may throw
+struct Sku
+{
+    int value;
+    friend bool operator==(const Sku&, const Sku&) = default;
+};
+
+}  // namespace stronger::tests
+
+template <>
+struct std::hash<stronger::tests::Sku>
+{
+    size_t operator()(const stronger::tests::Sku& sku) const { return std::hash<int>{}(sku.value); }
+};
+
+namespace stronger::tests
+{
+
+namespace
+{
+
+using namespace std::string_literals;
+using namespace std::string_view_literals;
+
+using Name = strong_type<std::string, tag("transparent_hash::Name")>;
+using NameView = strong_type<std::string_view, tag("transparent_hash::Name")>;
+using City = strong_type<std::string, tag("transparent_hash::City")>;
+using CityView = strong_type<std::string_view, tag("transparent_hash::City")>;
+
+using SkuId = strong_type<Sku, tag()>;
+
+using NameHash = transparent_hash<Name>;
+using NameEqualTo = transparent_equal_to<Name>;
+
+TEST_CASE("Transparent hash")
+{
+    SECTION("Accepted keys")
+    {
+        static_assert(concepts::borrowed_view_of<NameView, Name>);
+        static_assert(!concepts::borrowed_view_of<CityView, Name>);
+        static_assert(!concepts::borrowed_view_of<Name, NameView>);
+
+        static_assert(std::is_invocable_v<NameHash, const Name&>);
+        static_assert(std::is_invocable_v<NameHash, const NameView&>);
+        static_assert(!std::is_invocable_v<NameHash, const CityView&>);
+        static_assert(!std::is_invocable_v<NameHash, const std::string_view&>);
+        static_assert(!std::is_invocable_v<NameHash, const std::string&>);
+
+        static_assert(std::is_invocable_v<NameEqualTo, const Name&, const NameView&>);
+        static_assert(std::is_invocable_v<NameEqualTo, const NameView&, const Name&>);
+        static_assert(!std::is_invocable_v<NameEqualTo, const Name&, const CityView&>);
+        static_assert(!std::is_invocable_v<NameEqualTo, const Name&, const std::string_view&>);
+    }
+
+    SECTION("Noexcept when the hash of the underlying type is")
+    {
+        static_assert(noexcept(NameHash{}(std::declval<const Name&>())));
+        static_assert(!noexcept(transparent_hash<SkuId>{}(std::declval<const SkuId&>())));
+    }
+
+    SECTION("Views hash and compare like the values they refer to")
+    {
+        const Name name{ "Pierre"s };
+        const NameView view{ "Pierre"sv };
+        CHECK(NameHash{}(name) == NameHash{}(view));
+        CHECK(NameHash{}(name) == std::hash<Name>{}(name));
+        CHECK(NameEqualTo{}(name, view));
+        CHECK(NameEqualTo{}(view, name));
+        CHECK_FALSE(NameEqualTo{}(name, NameView{ "Laurie"sv }));
+    }
+
+    SECTION("Heterogeneous lookup in unordered containers")
+    {
+        const std::unordered_map<Name, int, NameHash, NameEqualTo> map = {
+            {Name("Pierre"s), 1},
+            {Name("Laurie"s), 2},
+        };
+        CHECK(map.find(NameView{ "Pierre"sv })->second == 1);
+        CHECK(map.find(NameView{ "Laurie"sv })->second == 2);
+        CHECK(map.find(NameView{ "Germain"sv }) == map.end());
+        CHECK(map.contains(NameView{ "Pierre"sv }));
+
+        const std::unordered_set<Name, NameHash, NameEqualTo> set = { Name("Pierre"s) };
+        CHECK(set.contains(NameView{ "Pierre"sv }));
+        CHECK(set.count(NameView{ "Laurie"sv }) == 0);
+    }
+}
+
+}  // namespace
+
+}  // namespace stronger::tests
@@ -3,6 +3,11 @@
 
 #include "stronger.hpp"
 #include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
 namespace stronger::tests
 {
 
@@ -0,0 +1,117 @@
+// Copyright (c) 2025 Clément Metz
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "helpers.h"
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <stronger.hpp>
+#include <stronger/units.hpp>
+#include <type_traits>
+
+namespace stronger::tests
+{
+
+namespace
+{
+
+using namespace units;
+
+using Hertz = quantity<double, unit<dimension<0, 0, -1>>>;
+using IntegralMeters = quantity<int64_t, meter>;
+using IntegralKilometers = quantity<int64_t, kilometer>;
+
+template <typename Quantity>
+concept has_sqrt = requires(const Quantity& value) { units::sqrt(value); };
+
+TEST_CASE("Units")
+{
+    SECTION("Multiplication and division combine dimensions")
+    {
+        static_assert(std::is_same_v<decltype(meters{} / seconds{}), meters_per_second>);
+        static_assert(std::is_same_v<decltype(meters_per_second{} / seconds{}), meters_per_second_squared>);
+        static_assert(std::is_same_v<decltype(kilograms{} * meters_per_second_squared{}), newtons>);
+        static_assert(std::is_same_v<decltype(newtons{} * meters{}), joules>);
+        static_assert(std::is_same_v<decltype(joules{} / seconds{}), watts>);
+        static_assert(std::is_same_v<decltype(kilometers{} / hours{}), kilometers_per_hour>);
+        static_assert(std::is_same_v<decltype(1.0 / seconds{}), Hertz>);
+        static_assert(std::is_same_v<decltype(meters{} / meters{}), quantity<double, one>>);
+        static_assert(*(meters{ 10.0 } / seconds{ 4.0 }) == 2.5);
+        static_assert(*(2.0 * meters{ 3.0 }) == 6.0);
+        static_assert(*(meters{ 3.0 } / 2.0) == 1.5);
+    }
+
+    SECTION("Addition and subtraction require the same dimension")
+    {
+        static_assert(addable<meters, meters>);
+        static_assert(addable<meters, kilometers>);
+        static_assert(!addable<meters, seconds>);
+        static_assert(!addable<meters, double>);
+        static_assert(!addable<meters, IntegralMeters>);
+        static_assert(!less_than_comparable<meters, seconds>);
+    }
+
+    SECTION("Quantities of different units are added in their common unit")
+    {
+        static_assert(std::is_same_v<decltype(kilometers{} + meters{}), meters>);
+        static_assert(std::is_same_v<decltype(hours{} - minutes{}), minutes>);
+        static_assert(std::is_same_v<decltype(meters{} + meters{}), meters>);
+        static_assert(*(kilometers{ 1.0 } + meters{ 2.0 }) == 1002.0);
+        static_assert(*(hours{ 1.0 } - minutes{ 15.0 }) == 45.0);
+        static_assert(*(IntegralKilometers{ 2 } - IntegralMeters{ 1 }) == 1999);
+    }
+
+    SECTION("Comparisons")
+    {
+        static_assert(kilometers{ 1.0 } == meters{ 1000.0 });
+        static_assert(kilometers{ 1.0 } > meters{ 999.0 });
+        static_assert(IntegralMeters{ 999 } < IntegralKilometers{ 1 });
+        static_assert(seconds{ 1.0 } != seconds{ 2.0 });
+    }
+
+    SECTION("Conversions")
+    {
+        static_assert(std::is_convertible_v<kilometers, meters>);
+        static_assert(std::is_convertible_v<meters, kilometers>);
+        static_assert(std::is_convertible_v<IntegralKilometers, IntegralMeters>);
+        static_assert(!std::is_convertible_v<IntegralMeters, IntegralKilometers>);
+        static_assert(!std::is_convertible_v<meters, seconds>);
+        static_assert(!std::is_convertible_v<double, meters>);
+        static_assert(*meters{ kilometers{ 2.0 } } == 2000.0);
+        static_assert(*meters_per_second{ kilometers_per_hour{ 36.0 } } == 10.0);
+        static_assert(*quantity_cast<IntegralKilometers>(IntegralMeters{ 2500 }) == 2);
+    }
+
+    SECTION("Compound assignments")
+    {
+        meters distance{ 1.0 };
+        distance += meters{ 2.0 };
+        CHECK(*distance == 3.0);
+        distance -= kilometers{ 0.001 };
+        CHECK(*distance == 2.0);
+        distance *= 4.0;
+        CHECK(*distance == 8.0);
+        distance /= 2.0;
+        CHECK(*distance == 4.0);
+        CHECK(*-distance == -4.0);
+    }
+
+    SECTION("Square root")
+    {
+        static_assert(has_sqrt<square_meters>);
+        static_assert(!has_sqrt<meters>);
+        static_assert(!has_sqrt<quantity<double, unit_product<kilometer, kilometer>>>);
+        static_assert(std::is_same_v<decltype(units::sqrt(square_meters{})), meters>);
+        CHECK(*units::sqrt(square_meters{ 9.0 }) == 3.0);
+    }
+
+    SECTION("Quantities have the size of their value")
+    {
+        static_assert(sizeof(meters) == sizeof(double));
+        static_assert(std::is_trivially_copyable_v<meters>);
+        static_assert(std::is_standard_layout_v<meters>);
+    }
+}
+
+}  // namespace
+
+}  // namespace stronger::tests